@@ -24,7 +24,8 @@ public class ALS : ModuleRules
             "SlateCore",
             "GameplayTags",
             "AIModule",
-            "DeveloperSettings"
+            "DeveloperSettings",
+            "TraceLog"
         });
 
         if (Target.bBuildEditor)
@@ -3,6 +3,10 @@
 #include "ALS.h"
 #include "ALS_Subsystem.h"
 #include "ALS_FileLog.h"
+#include "ALS_Globals.h"
+#include "ALS_Timers.h"
+#include "ALS_Metrics.h"
+#include "ALS_CallSiteStats.h"
 #include "ALS_LogsUMG.h"
 #include "ALS_PropertyUMG.h"
 #include "ALS_FunctionLibrary.h"
@@ -26,6 +30,8 @@ TSharedPtr<FALSInputProcessor> GInputProcessor = nullptr;
 
 void FALSModule::StartupModule()
 {   
+    UALS_FileLog::StartWriter();
+
     const bool bAllowFileLog = UALS_Settings::Get()->IsFileLoggingAllowed();
     const bool bAllowPropInspector = UALS_Settings::Get()->IsPropertyInspectorAllowed();
 
@@ -50,10 +56,26 @@ void FALSModule::StartupModule()
             ECVF_Default
         );
 
-        UALS_FileLog::RotateOlderLogs();
+        IConsoleManager::Get().RegisterConsoleCommand(
+            TEXT("alstoptalkers"),
+            TEXT("Lists the call sites that wrote the most log records. Usage: alstoptalkers [Count]"),
+            FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+                {
+                    FALSCallSiteStats::DumpTopTalkers(Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20);
+                }),
+            ECVF_Default
+        );
+
+        UALS_FileLog::RotateOlderLogsAsync();
         FWorldDelegates::OnStartGameInstance.AddStatic(&UALS_FileLog::OnStartGameInstance);
+        FWorldDelegates::OnWorldCleanup.AddStatic(&UALS_FileLog::OnWorldCleanup);
+
+        FALSTimers::StartSummaries();
+        FALSMetrics::StartSummaries();
     }
 
+    FWorldDelegates::OnWorldCleanup.AddStatic(&UALS_Globals::OnWorldCleanup);
+
     if (bAllowPropInspector)
     {
         IConsoleManager::Get().RegisterConsoleCommand(
@@ -72,6 +94,14 @@ void FALSModule::ShutdownModule()
 {
     IConsoleManager::Get().UnregisterConsoleObject(TEXT("alslogs"));
     IConsoleManager::Get().UnregisterConsoleObject(TEXT("alsproperty"));
+    IConsoleManager::Get().UnregisterConsoleObject(TEXT("alstoptalkers"));
+
+    FALSTimers::StopSummaries();
+    FALSMetrics::StopSummaries();
+
+    UALS_FileLog::WaitForRotation();
+    UALS_FileLog::StopWriter();
+    UALS_FileLog::CloseLogFiles();
 }
 
 void FALSModule::ShowLogWidget(UWorld* World)
@@ -0,0 +1,261 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_CallSiteStats.h"
+#include "ALS_FileLog.h"
+#include "ALS_NumberFormat.h"
+#include "ALS.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Algo/Sort.h"
+
+namespace ALSCallSiteStats
+{
+    static uint64 HashView(FStringView View, uint64 Seed)
+    {
+        return CityHash64WithSeed(reinterpret_cast<const char*>(View.GetData()), View.Len() * sizeof(TCHAR), Seed);
+    }
+
+    static void SortByMessages(TArray<FALSCallSiteSample>& Samples)
+    {
+        Algo::Sort(Samples, [](const FALSCallSiteSample& A, const FALSCallSiteSample& B)
+            {
+                return A.Messages != B.Messages ? A.Messages > B.Messages : A.Bytes > B.Bytes;
+            });
+    }
+}
+
+int32 FALSCallSiteStats::FindOrAddCallSite(const FString& LogFilePath, FStringView SourceID)
+{
+    // Hashes that collide with the reserved keys are moved aside
+    const uint64 Key = FMath::Max<uint64>(ALSCallSiteStats::HashView(SourceID, ALSCallSiteStats::HashView(LogFilePath, 0)), FirstKey);
+
+    // Lock free lookup, a probe chain ends at the first slot that was never used. Freed slots are stepped over
+    for (int32 Probe = 0; Probe < MaxCallSites; ++Probe)
+    {
+        const int32 Index = static_cast<int32>((Key + Probe) & (MaxCallSites - 1));
+        const uint64 SlotKey = Slots[Index].Key.load(std::memory_order_acquire);
+
+        if (SlotKey == Key) return Index;
+        if (SlotKey == EmptyKey) break;
+    }
+
+    // Claims are serialized, so the chain is probed again in case another thread published the key meanwhile
+    FScopeLock Lock(&SlotsLock);
+
+    int32 FreeIndex = INDEX_NONE;
+    for (int32 Probe = 0; Probe < MaxCallSites; ++Probe)
+    {
+        const int32 Index = static_cast<int32>((Key + Probe) & (MaxCallSites - 1));
+        const uint64 SlotKey = Slots[Index].Key.load(std::memory_order_relaxed);
+
+        if (SlotKey == Key) return Index;
+
+        if (SlotKey == TombstoneKey && FreeIndex == INDEX_NONE)
+        {
+            FreeIndex = Index;
+        }
+        else if (SlotKey == EmptyKey)
+        {
+            FreeIndex = FreeIndex == INDEX_NONE ? Index : FreeIndex;
+            break;
+        }
+    }
+
+    if (FreeIndex != INDEX_NONE)
+    {
+        FSlot& Slot = Slots[FreeIndex];
+
+        // A freed slot may still have counts from records that were queued before it was freed. The key is published last,
+        // so a caller that finds it always counts into a zeroed and filled slot
+        Slot.Messages.store(0, std::memory_order_relaxed);
+        Slot.Bytes.store(0, std::memory_order_relaxed);
+        Slot.Suppressed.store(0, std::memory_order_relaxed);
+        Slot.LastSeenNs.store(0, std::memory_order_relaxed);
+
+        Slot.LogFilePath = LogFilePath;
+        Slot.SourceID = SourceID;
+        Slot.Key.store(Key, std::memory_order_release);
+        return FreeIndex;
+    }
+
+    static std::atomic<bool> bReportedFull = false;
+    if (!bReportedFull.exchange(true))
+    {
+        UE_LOG(LogALS, Warning, TEXT("ALS call site statistics are full, %d call sites are tracked and new ones are not counted"), MaxCallSites);
+    }
+
+    return INDEX_NONE;
+}
+
+void FALSCallSiteStats::AddWritten(int32 CallSite, uint64 Bytes, uint64 TimestampNs)
+{
+    if (CallSite == INDEX_NONE) return;
+
+    FSlot& Slot = Slots[CallSite];
+    Slot.Messages.fetch_add(1, std::memory_order_relaxed);
+    Slot.Bytes.fetch_add(Bytes, std::memory_order_relaxed);
+    Slot.LastSeenNs.store(FMath::Max(Slot.LastSeenNs.load(std::memory_order_relaxed), TimestampNs), std::memory_order_relaxed);
+}
+
+void FALSCallSiteStats::AddSuppressed(int32 CallSite, uint64 TimestampNs)
+{
+    if (CallSite == INDEX_NONE) return;
+
+    FSlot& Slot = Slots[CallSite];
+    Slot.Suppressed.fetch_add(1, std::memory_order_relaxed);
+    Slot.LastSeenNs.store(FMath::Max(Slot.LastSeenNs.load(std::memory_order_relaxed), TimestampNs), std::memory_order_relaxed);
+}
+
+void FALSCallSiteStats::GetCallSites(const FString* LogFilePath, TArray<FALSCallSiteSample>& OutSamples)
+{
+    OutSamples.Reset();
+
+    const FALSClockAnchor& Anchor = UALS_FileLog::GetClockAnchor();
+
+    TArray<FALSCallSiteSample> Samples;
+    FScopeLock Lock(&SlotsLock);
+
+    for (FSlot& Slot : Slots)
+    {
+        if (Slot.Key.load(std::memory_order_relaxed) < FirstKey) continue;
+        if (LogFilePath && Slot.LogFilePath != *LogFilePath) continue;
+
+        FALSCallSiteSample Sample;
+        Sample.Messages = Slot.Messages.load(std::memory_order_relaxed);
+        Sample.Suppressed = Slot.Suppressed.load(std::memory_order_relaxed);
+        if (Sample.Messages == 0 && Sample.Suppressed == 0) continue;
+
+        Sample.SourceID = Slot.SourceID;
+        Sample.Bytes = Slot.Bytes.load(std::memory_order_relaxed);
+        Sample.LastSeenUnixNs = Anchor.ToUnixNs(Slot.LastSeenNs.load(std::memory_order_relaxed));
+        Samples.Add(MoveTemp(Sample));
+    }
+
+    // A call site claimed again after its slot was freed can briefly hold two slots
+    MergeSamples(Samples, OutSamples);
+}
+
+FString FALSCallSiteStats::GetSidecarPath(const FString& LogFilePath)
+{
+    return FPaths::ChangeExtension(LogFilePath, SidecarExtension);
+}
+
+bool FALSCallSiteStats::PersistSidecar(const FString& LogFilePath, const FString& SessionID)
+{
+    const FALSClockAnchor& Anchor = UALS_FileLog::GetClockAnchor();
+
+    // "<Session>\t<Source>\t<Messages>\t<Bytes>\t<Suppressed>\t<LastSeenUnixNs>", one line per call site
+    TStringBuilder<1024> Lines;
+    {
+        FScopeLock Lock(&SlotsLock);
+
+        for (FSlot& Slot : Slots)
+        {
+            if (Slot.Key.load(std::memory_order_relaxed) < FirstKey || Slot.LogFilePath != LogFilePath) continue;
+
+            const uint64 Messages = Slot.Messages.exchange(0, std::memory_order_relaxed);
+            const uint64 Bytes = Slot.Bytes.exchange(0, std::memory_order_relaxed);
+            const uint64 Suppressed = Slot.Suppressed.exchange(0, std::memory_order_relaxed);
+            const uint64 LastSeenNs = Slot.LastSeenNs.exchange(0, std::memory_order_relaxed);
+
+            // The file's records are all counted by now, the slot goes back to the table. The next record from this call site claims a slot again.
+            // A tombstone rather than an empty key, so the chains of other call sites that probed past this slot stay intact
+            Slot.Key.store(TombstoneKey, std::memory_order_release);
+
+            if (Messages == 0 && Suppressed == 0) continue;
+
+            Lines.Append(SessionID);
+            Lines.AppendChar(TEXT('\t'));
+            Lines.Append(Slot.SourceID);
+            Lines.AppendChar(TEXT('\t'));
+            FALSNumberFormat::AppendUInt(Lines, Messages);
+            Lines.AppendChar(TEXT('\t'));
+            FALSNumberFormat::AppendUInt(Lines, Bytes);
+            Lines.AppendChar(TEXT('\t'));
+            FALSNumberFormat::AppendUInt(Lines, Suppressed);
+            Lines.AppendChar(TEXT('\t'));
+            FALSNumberFormat::AppendInt(Lines, Anchor.ToUnixNs(LastSeenNs));
+            Lines.AppendChar(TEXT('\n'));
+        }
+    }
+
+    if (Lines.Len() == 0) return true;
+
+    return FFileHelper::SaveStringToFile(Lines.ToView(), *GetSidecarPath(LogFilePath), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+bool FALSCallSiteStats::LoadSidecar(const FString& LogFilePath, const FString& SessionID, TArray<FALSCallSiteSample>& OutSamples)
+{
+    OutSamples.Reset();
+
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *GetSidecarPath(LogFilePath)))
+    {
+        return false;
+    }
+
+    TArray<FALSCallSiteSample> Samples;
+    TArray<FString> Columns;
+    for (const FString& Line : Lines)
+    {
+        Line.ParseIntoArray(Columns, TEXT("\t"), false);
+        if (Columns.Num() != 6 || Columns[0] != SessionID) continue;
+
+        FALSCallSiteSample& Sample = Samples.AddDefaulted_GetRef();
+        Sample.SourceID = Columns[1];
+        Sample.Messages = FCString::Strtoui64(*Columns[2], nullptr, 10);
+        Sample.Bytes = FCString::Strtoui64(*Columns[3], nullptr, 10);
+        Sample.Suppressed = FCString::Strtoui64(*Columns[4], nullptr, 10);
+        Sample.LastSeenUnixNs = FCString::Atoi64(*Columns[5]);
+    }
+
+    // A file released several times in one session has one block per release
+    MergeSamples(Samples, OutSamples);
+    return true;
+}
+
+void FALSCallSiteStats::MergeSamples(const TArray<FALSCallSiteSample>& Samples, TArray<FALSCallSiteSample>& OutSamples)
+{
+    TMap<FString, int32> IndexBySource;
+    for (int32 i = 0; i < OutSamples.Num(); ++i)
+    {
+        IndexBySource.Add(OutSamples[i].SourceID, i);
+    }
+
+    for (const FALSCallSiteSample& Sample : Samples)
+    {
+        int32& Index = IndexBySource.FindOrAdd(Sample.SourceID, INDEX_NONE);
+        if (Index == INDEX_NONE)
+        {
+            Index = OutSamples.Add(Sample);
+            continue;
+        }
+
+        FALSCallSiteSample& Merged = OutSamples[Index];
+        Merged.Messages += Sample.Messages;
+        Merged.Bytes += Sample.Bytes;
+        Merged.Suppressed += Sample.Suppressed;
+        Merged.LastSeenUnixNs = FMath::Max(Merged.LastSeenUnixNs, Sample.LastSeenUnixNs);
+    }
+
+    ALSCallSiteStats::SortByMessages(OutSamples);
+}
+
+void FALSCallSiteStats::DumpTopTalkers(int32 NumTop)
+{
+    TArray<FALSCallSiteSample> Samples;
+    GetCallSites(nullptr, Samples);
+
+    // The same source logging into several instance files counts once
+    TArray<FALSCallSiteSample> Merged;
+    MergeSamples(Samples, Merged);
+
+    UE_LOG(LogALS, Display, TEXT("ALS top talkers, %d of %d call sites:"), FMath::Min(NumTop, Merged.Num()), Merged.Num());
+    for (int32 i = 0; i < FMath::Min(NumTop, Merged.Num()); ++i)
+    {
+        const FALSCallSiteSample& Sample = Merged[i];
+        UE_LOG(LogALS, Display, TEXT("  %-40s messages %llu | bytes %llu | suppressed %llu"), *Sample.SourceID, Sample.Messages, Sample.Bytes, Sample.Suppressed);
+    }
+}
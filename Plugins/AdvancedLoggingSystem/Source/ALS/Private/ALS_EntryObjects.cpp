@@ -1,14 +1,19 @@
 ﻿//Copyright © 2025 RTerofer. All Rights Reserved.
 
 #include "ALS_EntryObjects.h"
+#include "ALS_Stats.h"
 
 // Log Message Object
 void UALS_LogMsgObject::SetMessageEntry(const FLogEntries& LogEntry, const bool& bIsBatch)
 {
     Message = FText::FromString(LogEntry.Message);
     DateTime = FText::FromString(LogEntry.DateTime);
-    PeriodMessage = FText::FromString(bIsBatch ? LogEntry.PeriodMessage : TEXT(""));
+    PeriodMessage = FText::FromString(bIsBatch || LogEntry.Count > 1 ? LogEntry.PeriodMessage : TEXT(""));
     Level = LogEntry.Level;
+    Instance = FText::FromString(LogEntry.Instance);
+    Context = FText::FromString(LogEntry.Context);
+    Frame = LogEntry.Frame;
+    ValueRange = FText::FromString(LogEntry.ValueRange);
 };
 
 // Log Context Object
@@ -71,12 +76,16 @@ void UALS_PropMsgObject::StartSubscription()
 
 bool UALS_PropMsgObject::TickableSubscribe(float DeltaTime)
 {
+    ALS_STAT_SCOPE(InspectorTick);
+
     if (!VarContext || !VarProperty || !VarOwner)
     {
         FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
         return false;
     }
 
+    ALS_STAT_ADD(InspectorTicked, 1);
+
     PropertyName = VarProperty->GetName();
     TStringBuilder<256> OutValue;
     OutValue.Appendf(TEXT(""));
@@ -125,6 +134,10 @@ bool UALS_PropMsgObject::TickableSubscribe(float DeltaTime)
 
         PrevMessage = Message;
     }
+    else
+    {
+        ALS_STAT_ADD(InspectorSkipped, 1);
+    }
 
     return true;
 }
@@ -2,7 +2,16 @@
 
 #include "ALS_FileLog.h"
 #include "ALS_Macro.h"
+#include "ALS_Trace.h"
+#include "ALS_Stats.h"
+#include "ALS_LogArchive.h"
+#include "ALS_LogSegments.h"
+#include "ALS_CallSiteStats.h"
 #include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/StringBuilder.h"
+#include "HAL/ThreadManager.h"
+#include "Hash/CityHash.h"
 #include "Engine/GameInstance.h"
 
 
@@ -21,101 +30,911 @@ void UALS_FileLog::OnStartGameInstance(UGameInstance* GameInstance)
     }
 }
 
+namespace ALSFileLog
+{
+    // Reused by every record written from the same thread, so steady state logging formats without allocating
+    static TStringBuilder<1024>& GetRecordBuilder()
+    {
+        static thread_local TStringBuilder<1024> RecordBuilder;
+        RecordBuilder.Reset();
+        return RecordBuilder;
+    }
+
+    // Records written off the game thread carry ";t<ThreadId>:<ThreadName>" after the frame tag. Always last, the name may contain anything
+    static uint32 GetRecordThreadId()
+    {
+        return IsInGameThread() ? 0 : FPlatformTLS::GetCurrentThreadId();
+    }
+
+    static void AppendThreadMeta(FStringBuilderBase& Record, uint32 ThreadId)
+    {
+        if (ThreadId == 0) return;
+
+        Record.Appendf(TEXT(";t%u:"), ThreadId);
+        Record.Append(FThreadManager::GetThreadName(ThreadId));
+    }
+
+    // Files that could not be opened, reported once instead of once per record. Guarded by the writer lock
+    static TSet<FString> FailedLogFiles;
+
+    // A record must fit the ring with room to spare, bigger ones are written by the producer itself
+    static constexpr uint64 MaxRingRecordBytes = FALSRecordRing::Capacity / 4;
+
+    static uint64 GetRingRecordSize(int32 NumBytes)
+    {
+        return Align(sizeof(FALSRingRecord) + NumBytes, 8);
+    }
+
+    static void CopyToRing(FALSRecordRing& Ring, uint64 Offset, const void* Source, uint64 Num)
+    {
+        const uint64 Start = Offset % FALSRecordRing::Capacity;
+        const uint64 First = FMath::Min(Num, FALSRecordRing::Capacity - Start);
+
+        FMemory::Memcpy(Ring.Data + Start, Source, First);
+        FMemory::Memcpy(Ring.Data, static_cast<const uint8*>(Source) + First, Num - First);
+    }
+
+    static void CopyFromRing(const FALSRecordRing& Ring, uint64 Offset, void* Dest, uint64 Num)
+    {
+        const uint64 Start = Offset % FALSRecordRing::Capacity;
+        const uint64 First = FMath::Min(Num, FALSRecordRing::Capacity - Start);
+
+        FMemory::Memcpy(Dest, Ring.Data + Start, First);
+        FMemory::Memcpy(static_cast<uint8*>(Dest) + First, Ring.Data, Num - First);
+    }
+
+    // Owns the calling thread's ring, marks it retired when the thread exits
+    struct FRingHandle
+    {
+        FALSRecordRing* Ring = nullptr;
+
+        ~FRingHandle()
+        {
+            if (Ring)
+            {
+                Ring->bRetired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    static uint64 HashView(FStringView View, uint64 Seed)
+    {
+        return CityHash64WithSeed(reinterpret_cast<const char*>(View.GetData()), View.Len() * sizeof(TCHAR), Seed);
+    }
+
+    // Keeps the string's buffer, so a repeat run that starts over does not allocate once its strings have grown
+    static void AssignView(FString& Dest, FStringView Source)
+    {
+        Dest.Reset(Source.Len());
+        Dest.Append(Source);
+    }
+}
+
 bool UALS_FileLog::CreateMessageLog(const UObject* Context, const FString& CallerName, const FString& SourceID, const FString& Level, const FString& Message)
 {
+    return WriteMessageRecord(Context, CallerName, SourceID, Level, Message);
+}
+
+bool UALS_FileLog::CreateMessageLog(const UObject* Context, const FString& SourceID, const FString& Message, const ELogSeverity& LogSeverity)
+{
+    TStringBuilder<256> Caller;
+    UALS_Globals::AppendContextCaller(Context, Caller);
+
+    return WriteMessageRecord(Context, Caller.ToView(), SourceID, GetSeverityName(LogSeverity), Message);
+}
+
+bool UALS_FileLog::WriteMessageRecord(const UObject* Context, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message)
+{
+    ALS_TRACE_SCOPE(CreateMessageLog);
+
     bool bAllowFileLog = UALS_Settings::Get()->IsFileLoggingAllowed();
     if (!bAllowFileLog || !Context || !Context->GetWorld()) return false;
 
-    FString LogFilePath = UALS_Settings::Get()->FileLogRootDir.Path / GetCurrentInstance(Context->GetWorld()) + TEXT(".log");
+    int32 FileId = INDEX_NONE;
+    {
+        FScopeLock Lock(&WorldLogLock);
 
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    if (PlatformFile.IsReadOnly(*LogFilePath))
+        const FALSWorldLogState& WorldState = FindOrAddWorldState(Context->GetWorld());
+        if (!WorldState.bWritable || WorldState.FileId == INDEX_NONE) return false;
+
+        FileId = WorldState.FileId;
+
+        if (!IsAnchored(FileId))
+        {
+            CreateSessionLog(Context->GetWorld());
+        }
+    }
+
+    return WriteMessageRecord(FileId, CallerName, SourceID, Level, Message);
+}
+
+bool UALS_FileLog::CreateThreadMessageLog(FStringView CallerName, FStringView SourceID, ELogSeverity LogSeverity, FStringView Message)
+{
+    return WriteThreadRecord(CallerName, SourceID, GetSeverityName(LogSeverity), Message, FStringView());
+}
+
+bool UALS_FileLog::CreateSummaryLog(FStringView CallerName, FStringView SourceID, FStringView Message)
+{
+    return WriteThreadRecord(CallerName, SourceID, GetSeverityName(ELogSeverity::Info), Message, SummaryMeta);
+}
+
+bool UALS_FileLog::WriteThreadRecord(FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, FStringView Meta)
+{
+    ALS_TRACE_SCOPE(CreateMessageLog);
+
+    if (!UALS_Settings::Get()->IsFileLoggingAllowed()) return false;
+
+    // Steady state is two atomic loads, the lock is only taken to pick the background file or to anchor a file for a new session
+    int32 FileId = ThreadLogFileId.load(std::memory_order_acquire);
+    if (FileId == INDEX_NONE || !IsAnchored(FileId))
     {
-        UE_LOG(LogALS, Error, TEXT("Directory not writable: %s"), *LogFilePath);
-        return false;
+        FScopeLock Lock(&WorldLogLock);
+
+        FileId = ThreadLogFileId.load(std::memory_order_acquire);
+        if (FileId == INDEX_NONE)
+        {
+            FileId = FindOrAddLogFileId(UALS_Settings::Get()->FileLogRootDir.Path / FString::Printf(TEXT("%s_Background.log"), FApp::GetProjectName()));
+            ThreadLogFileId.store(FileId, std::memory_order_release);
+        }
+
+        if (FileId == INDEX_NONE || (!IsAnchored(FileId) && !WriteAnchorRecord(FileId)))
+        {
+            return false;
+        }
     }
 
-    uint64 CycleCounter = FPlatformTime::Cycles64();
-    FString SessionTime = GetSessionTime();
-    FString DateTimeStr = FDateTime::Now()
-        .ToString(TEXT("%Y.%m.%d-%H.%M.%S.%s"));
-    FString SafeMessage = EscapeForLog(Message);
-
-    FString LogEntry = FString::Printf(
-        TEXT("%llu-|ALS|-%s-|ALS|-%s-|ALS|-%s-|ALS|-%s-|ALS|-%s-|ALS|-%s\n"),
-        CycleCounter,
-        *DateTimeStr,
-        *SessionTime,
-        *CallerName,
-        *SourceID,
-        *Level,
-        *SafeMessage
-    );
+    return WriteMessageRecord(FileId, CallerName, SourceID, Level, Message, Meta);
+}
 
-    const bool FileLogSuccess = FFileHelper::SaveStringToFile(
-        LogEntry,
-        *LogFilePath,
-        FFileHelper::EEncodingOptions::AutoDetect,
-        &IFileManager::Get(),
-        FILEWRITE_Append
-    );
+bool UALS_FileLog::WriteMessageRecord(int32 FileId, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, FStringView Meta)
+{
+    // Taken before any repeat shard lock, a session refresh takes WorldLogLock
+    const FString& SessionID = GetThreadSessionTime();
+    const uint64 TimestampNs = GetMonotonicNs();
 
-    return FileLogSuccess;
+    // Summaries and other tagged records are never collapsed
+    if (Meta.IsEmpty() && CollapseRepeat(FileId, SessionID, CallerName, SourceID, Level, Message, TimestampNs))
+    {
+        return true;
+    }
+
+    return WriteFormattedRecord(FileId, SessionID, TimestampNs, GFrameCounter, CallerName, SourceID, Level, Message, Meta);
 }
 
-bool UALS_FileLog::CreateMessageLog(const UObject* Context, const FString& SourceID, const FString& Message, const ELogSeverity& LogSeverity)
+bool UALS_FileLog::WriteFormattedRecord(int32 FileId, FStringView SessionID, uint64 TimestampNs, uint64 Frame, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, FStringView Meta)
 {
-    FString Caller;
-    FString Network;
-    UALS_Globals::GetContextAndNetwork(Context, Caller, Network);
+    TStringBuilder<1024>& Record = ALSFileLog::GetRecordBuilder();
+    Record.AppendChar(TEXT('T'));
+    FALSNumberFormat::AppendUInt(Record, TimestampNs);
+    Record.Append(TEXT("-|ALS|-f"));
+    FALSNumberFormat::AppendUInt(Record, Frame);
+    if (Meta.IsEmpty())
+    {
+        ALSFileLog::AppendThreadMeta(Record, ALSFileLog::GetRecordThreadId());
+    }
+    else
+    {
+        Record.AppendChar(TEXT(';'));
+        Record.Append(Meta);
+    }
+    Record.Append(TEXT("-|ALS|-"));
+    Record.Append(SessionID);
+    Record.Append(TEXT("-|ALS|-"));
+    Record.Append(CallerName);
+    Record.Append(TEXT("-|ALS|-"));
+    Record.Append(SourceID);
+    Record.Append(TEXT("-|ALS|-"));
+    Record.Append(Level);
+    Record.Append(TEXT("-|ALS|-"));
+    AppendEscapedForLog(Record, Message);
+    Record.AppendChar(TEXT('\n'));
 
-    UEnum* LevelType = StaticEnum<ELogSeverity>();
-    uint8 LevelValue = static_cast<uint8>(LogSeverity);
-    FString Severity = LevelType->GetNameStringByValue(LevelValue);
+    return WriteRecord(FileId, Record, FALSCallSiteStats::FindOrAddCallSite(GetLogFilePath(FileId), SourceID), TimestampNs);
+}
+
+bool UALS_FileLog::CollapseRepeat(int32 FileId, FStringView SessionID, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, uint64 TimestampNs)
+{
+    if (!UALS_Settings::Get()->bCollapseRepeatedMessages) return false;
 
-    return UALS_FileLog::CreateMessageLog(Context, Caller, SourceID, Severity, Message);
+    const uint64 RunKey = ALSFileLog::HashView(SourceID, ALSFileLog::HashView(CallerName, FileId));
+    const uint64 MessageHash = ALSFileLog::HashView(Message, ALSFileLog::HashView(Level, 0));
+
+    // The ended run is swapped out and its trailer written after the shard lock is released. The new run reuses the strings swapped in
+    static thread_local FALSRepeatRun EndedRun;
+    {
+        FRepeatShard& Shard = RepeatShards[RunKey % NumRepeatShards];
+        FScopeLock Lock(&Shard.Lock);
+
+        FALSRepeatRun& Run = Shard.Runs.FindOrAdd(RunKey);
+
+        // A run ends when its message changes, its file is released or it goes stale, the viewer reads open runs from GetOpenRepeatRuns
+        if (Run.FirstNs != 0 && Run.MessageHash == MessageHash)
+        {
+            Run.Repeats++;
+            Run.LastNs = TimestampNs;
+            Run.LastFrame = GFrameCounter;
+            FALSCallSiteStats::AddSuppressed(Run.CallSite, TimestampNs);
+            return true;
+        }
+
+        Swap(Run, EndedRun);
+
+        Run.FileId = FileId;
+        ALSFileLog::AssignView(Run.CallerName, CallerName);
+        ALSFileLog::AssignView(Run.SourceID, SourceID);
+        ALSFileLog::AssignView(Run.Level, Level);
+        ALSFileLog::AssignView(Run.Message, Message);
+        Run.MessageHash = MessageHash;
+        Run.FirstNs = TimestampNs;
+        Run.LastNs = TimestampNs;
+        Run.LastFrame = GFrameCounter;
+        Run.Repeats = 0;
+        Run.CallSite = FALSCallSiteStats::FindOrAddCallSite(GetLogFilePath(FileId), SourceID);
+        Run.ThreadId = ALSFileLog::GetRecordThreadId();
+    }
+
+    if (EndedRun.Repeats > 0)
+    {
+        WriteRepeatTrailer(EndedRun, SessionID, TimestampNs);
+    }
+    return false;
 }
 
-bool UALS_FileLog::CreateSessionLog(const UWorld* World)
+void UALS_FileLog::EndRepeatRuns(int32 FileId)
 {
-    if (!World)
+    const FString& SessionID = GetThreadSessionTime();
+
+    // Trailers are written after each shard lock is released
+    TArray<FALSRepeatRun> EndedRuns;
+    for (FRepeatShard& Shard : RepeatShards)
     {
-        UE_LOG(LogALS, Error, TEXT("No Valid World Found: Can't create Session log. Provide a valid World Context"));
+        {
+            FScopeLock Lock(&Shard.Lock);
+
+            for (auto It = Shard.Runs.CreateIterator(); It; ++It)
+            {
+                FALSRepeatRun& Run = It.Value();
+                if (FileId != INDEX_NONE && Run.FileId != FileId) continue;
+
+                if (Run.Repeats > 0)
+                {
+                    EndedRuns.Add(MoveTemp(Run));
+                }
+
+                It.RemoveCurrent();
+            }
+        }
+
+        for (const FALSRepeatRun& Run : EndedRuns)
+        {
+            WriteRepeatTrailer(Run, SessionID, GetMonotonicNs());
+        }
+        EndedRuns.Reset();
+    }
+}
+
+void UALS_FileLog::EndStaleRepeatRuns()
+{
+    const UALS_Settings* Settings = UALS_Settings::Get();
+    const uint64 MaxAgeNs = static_cast<uint64>(FMath::Max(Settings->RepeatFlushInterval, 1.0f) * 1e9);
+    const uint64 NowNs = GetMonotonicNs();
+
+    const FString& SessionID = GetThreadSessionTime();
+
+    TArray<FALSRepeatRun> EndedRuns;
+    for (FRepeatShard& Shard : RepeatShards)
+    {
+        {
+            FScopeLock Lock(&Shard.Lock);
+
+            for (TPair<uint64, FALSRepeatRun>& Pair : Shard.Runs)
+            {
+                FALSRepeatRun& Run = Pair.Value;
+                if (Run.Repeats == 0 || (NowNs - Run.FirstNs < MaxAgeNs && Run.Repeats < Settings->MaxCollapsedRepeats)) continue;
+
+                EndedRuns.Add(Run);
+                Run.FirstNs = 0;
+                Run.Repeats = 0;
+            }
+        }
+
+        for (const FALSRepeatRun& Run : EndedRuns)
+        {
+            WriteRepeatTrailer(Run, SessionID, NowNs);
+        }
+        EndedRuns.Reset();
+    }
+}
+
+bool UALS_FileLog::WriteRepeatTrailer(const FALSRepeatRun& Run, FStringView SessionID, uint64 TimestampNs)
+{
+    TStringBuilder<128> Trailer;
+    Trailer.Appendf(TEXT("r%d:%llu:%llu"), Run.Repeats, Run.FirstNs, Run.LastNs);
+    ALSFileLog::AppendThreadMeta(Trailer, Run.ThreadId);
+
+    return WriteFormattedRecord(Run.FileId, SessionID, TimestampNs, GFrameCounter, Run.CallerName, Run.SourceID, Run.Level, Run.Message, Trailer.ToView());
+}
+
+void UALS_FileLog::GetOpenRepeatRuns(const FString& LogFilePath, TArray<FALSRepeatRun>& OutRuns)
+{
+    const int32 FileId = FindLogFileId(LogFilePath);
+    if (FileId == INDEX_NONE) return;
+
+    for (FRepeatShard& Shard : RepeatShards)
+    {
+        FScopeLock Lock(&Shard.Lock);
+
+        for (const TPair<uint64, FALSRepeatRun>& Pair : Shard.Runs)
+        {
+            if (Pair.Value.FileId == FileId && Pair.Value.Repeats > 0)
+            {
+                OutRuns.Add(Pair.Value);
+            }
+        }
+    }
+}
+
+FALSRecordRing& UALS_FileLog::GetRecordRing()
+{
+    static thread_local ALSFileLog::FRingHandle RingHandle;
+    if (!RingHandle.Ring)
+    {
+        RingHandle.Ring = new FALSRecordRing();
+
+        FScopeLock Lock(&RingsLock);
+        RecordRings.Add(RingHandle.Ring);
+    }
+
+    return *RingHandle.Ring;
+}
+
+bool UALS_FileLog::WriteRecord(int32 FileId, const FStringBuilderBase& Record, int32 CallSite, uint64 TimestampNs, EALSRingRecordKind Kind)
+{
+    if (FileId == INDEX_NONE) return false;
+
+    // Records are always appended as UTF-8, the viewer's reader decodes it line by line. The scratch buffer only grows, once per thread
+    static thread_local TArray<UTF8CHAR> Utf8Record;
+    const int32 NumBytes = FPlatformString::ConvertedLength<UTF8CHAR>(Record.GetData(), Record.Len());
+    if (Utf8Record.Num() < NumBytes)
+    {
+        Utf8Record.SetNumUninitialized(NumBytes);
+    }
+    FPlatformString::Convert(Utf8Record.GetData(), NumBytes, Record.GetData(), Record.Len());
+
+    FALSRingRecord Header;
+    Header.TimestampNs = TimestampNs != 0 ? TimestampNs : GetMonotonicNs();
+    Header.FileId = FileId;
+    Header.CallSite = CallSite;
+    Header.NumBytes = NumBytes;
+    Header.Kind = Kind;
+
+    const uint64 RecordSize = ALSFileLog::GetRingRecordSize(NumBytes);
+
+    // Too big for the ring: everything before it is written first, so it still lands in order
+    if (RecordSize > ALSFileLog::MaxRingRecordBytes)
+    {
+        FScopeLock Lock(&WriterLock);
+        DrainPendingRecords();
+
+        TSet<int32> TouchedFiles;
+        WritePendingRecord(Header, reinterpret_cast<const uint8*>(Utf8Record.GetData()), NumBytes, nullptr, 0, TouchedFiles);
+        if (FALSLogFileWriter* FileWriter = LogFileWriters.Find(FileId))
+        {
+            FileWriter->Archive->Flush();
+        }
+        return true;
+    }
+
+    FALSRecordRing& Ring = GetRecordRing();
+    const uint64 Head = Ring.Head.load(std::memory_order_relaxed);
+
+    // A full ring is drained by this thread when the writer is idle, otherwise it waits for the writer to make room
+    while (FALSRecordRing::Capacity - (Head - Ring.Tail.load(std::memory_order_acquire)) < RecordSize)
+    {
+        if (WriterLock.TryLock())
+        {
+            DrainPendingRecords();
+            WriterLock.Unlock();
+        }
+        else
+        {
+            ScheduleWrite();
+            FPlatformProcess::Yield();
+        }
+    }
+
+    ALSFileLog::CopyToRing(Ring, Head, &Header, sizeof(FALSRingRecord));
+    ALSFileLog::CopyToRing(Ring, Head + sizeof(FALSRingRecord), Utf8Record.GetData(), NumBytes);
+    Ring.Head.store(Head + RecordSize, std::memory_order_release);
+
+    INC_DWORD_STAT(STAT_ALS_FileQueueDepth);
+    ScheduleWrite();
+    return true;
+}
+
+void UALS_FileLog::ScheduleWrite()
+{
+    FEvent* Event = WriterEvent.load(std::memory_order_acquire);
+    if (!Event)
+    {
+        DrainPendingRecords();
+        return;
+    }
+
+    // The plain load keeps the common case, a writer already woken, off the shared cache line. Triggering does not allocate, launching a task per batch did
+    if (bWriteScheduled.load(std::memory_order_relaxed) || bWriteScheduled.exchange(true)) return;
+
+    Event->Trigger();
+}
+
+void UALS_FileLog::RunWriter(FEvent* Event)
+{
+    while (!bStopWriter.load(std::memory_order_acquire))
+    {
+        Event->Wait(WriterTickMs);
+
+        // Cleared before draining, a record published during the drain wakes the writer again instead of being missed
+        bWriteScheduled = false;
+        EndStaleRepeatRuns();
+        DrainPendingRecords();
+    }
+}
+
+void UALS_FileLog::StartWriter()
+{
+    if (WriterEvent.load(std::memory_order_acquire)) return;
+
+    FEvent* Event = FPlatformProcess::GetSynchEventFromPool(false);
+    bStopWriter = false;
+    WriterThread = FThread(TEXT("ALSFileWriter"), [Event]() { RunWriter(Event); }, 0, TPri_BelowNormal);
+    WriterEvent.store(Event, std::memory_order_release);
+}
+
+void UALS_FileLog::StopWriter()
+{
+    FEvent* Event = WriterEvent.exchange(nullptr);
+    if (!Event) return;
+
+    bStopWriter = true;
+    Event->Trigger();
+    WriterThread.Join();
+
+    // Not returned to the pool, a producer may still trigger the pointer it loaded before the exchange
+    DrainPendingRecords();
+}
+
+void UALS_FileLog::DrainPendingRecords()
+{
+    ALS_STAT_SCOPE(FileWrite);
+
+    FScopeLock Lock(&WriterLock);
+
+    struct FRingCursor
+    {
+        FALSRecordRing* Ring = nullptr;
+        uint64 Cursor = 0;
+        uint64 Limit = 0;
+        FALSRingRecord Next;
+    };
+
+    TArray<FRingCursor, TInlineAllocator<32>> Cursors;
+    {
+        FScopeLock RingsScopeLock(&RingsLock);
+
+        for (FALSRecordRing* Ring : RecordRings)
+        {
+            FRingCursor& Cursor = Cursors.AddDefaulted_GetRef();
+            Cursor.Ring = Ring;
+            Cursor.Cursor = Ring->Tail.load(std::memory_order_relaxed);
+            Cursor.Limit = Ring->Head.load(std::memory_order_acquire);
+        }
+    }
+
+    auto ReadNext = [](FRingCursor& Cursor)
+        {
+            if (Cursor.Cursor < Cursor.Limit)
+            {
+                ALSFileLog::CopyFromRing(*Cursor.Ring, Cursor.Cursor, &Cursor.Next, sizeof(FALSRingRecord));
+            }
+        };
+
+    for (FRingCursor& Cursor : Cursors)
+    {
+        ReadNext(Cursor);
+    }
+
+    TSet<int32> TouchedFiles;
+
+    // Each ring is in time order already, taking the oldest head each time keeps the file in time order across threads
+    while (true)
+    {
+        FRingCursor* Oldest = nullptr;
+        for (FRingCursor& Cursor : Cursors)
+        {
+            if (Cursor.Cursor < Cursor.Limit && (!Oldest || Cursor.Next.TimestampNs < Oldest->Next.TimestampNs))
+            {
+                Oldest = &Cursor;
+            }
+        }
+
+        if (!Oldest) break;
+
+        const FALSRingRecord& Record = Oldest->Next;
+        const uint64 DataStart = (Oldest->Cursor + sizeof(FALSRingRecord)) % FALSRecordRing::Capacity;
+        const int32 NumData = static_cast<int32>(FMath::Min<uint64>(Record.NumBytes, FALSRecordRing::Capacity - DataStart));
+
+        WritePendingRecord(Record, Oldest->Ring->Data + DataStart, NumData, Oldest->Ring->Data, Record.NumBytes - NumData, TouchedFiles);
+        DEC_DWORD_STAT(STAT_ALS_FileQueueDepth);
+
+        // Released per record, a producer waiting for room continues right away
+        Oldest->Cursor += ALSFileLog::GetRingRecordSize(Record.NumBytes);
+        Oldest->Ring->Tail.store(Oldest->Cursor, std::memory_order_release);
+        ReadNext(*Oldest);
+    }
+
+    // Flushed once per batch and only after whole records, so the Logs Viewer never sees a partial line
+    for (const int32 FileId : TouchedFiles)
+    {
+        if (FALSLogFileWriter* FileWriter = LogFileWriters.Find(FileId))
+        {
+            FileWriter->Archive->Flush();
+        }
+    }
+
+    // Rings of exited threads are freed once nothing is left in them
+    FScopeLock RingsScopeLock(&RingsLock);
+    for (int32 i = RecordRings.Num() - 1; i >= 0; --i)
+    {
+        FALSRecordRing* Ring = RecordRings[i];
+        if (Ring->bRetired.load(std::memory_order_acquire) && Ring->Head.load(std::memory_order_acquire) == Ring->Tail.load(std::memory_order_relaxed))
+        {
+            RecordRings.RemoveAtSwap(i);
+            delete Ring;
+        }
+    }
+}
+
+bool UALS_FileLog::WritePendingRecord(const FALSRingRecord& Record, const uint8* Data, int32 NumData, const uint8* WrappedData, int32 NumWrapped, TSet<int32>& OutTouchedFiles)
+{
+    const int32 FileId = Record.FileId;
+    const FString& LogFilePath = GetLogFilePath(FileId);
+
+    if (Record.Kind == EALSRingRecordKind::CloseFile)
+    {
+        LogFileWriters.Remove(FileId);
+        OutTouchedFiles.Remove(FileId);
+
+        // The marker carries the session the file was written in. Every record of the file before it is counted by now
+        TArray<ANSICHAR, TInlineAllocator<64>> Session;
+        Session.Append(reinterpret_cast<const ANSICHAR*>(Data), NumData);
+        Session.Append(reinterpret_cast<const ANSICHAR*>(WrappedData), NumWrapped);
+        FALSCallSiteStats::PersistSidecar(LogFilePath, FString(FUTF8ToTCHAR(Session.GetData(), Session.Num())));
+        return true;
+    }
+
+    FALSLogFileWriter& FileWriter = LogFileWriters.FindOrAdd(FileId);
+    if (!FileWriter.Archive.IsValid())
+    {
+        // Continues the last segment of the logical log, a restarted session keeps appending where the previous one stopped
+        if (!OpenLogFileWriter(LogFilePath, FileWriter, FALSLogSegments::GetLastSegmentIndex(LogFilePath)))
+        {
+            LogFileWriters.Remove(FileId);
+
+            if (!ALSFileLog::FailedLogFiles.Contains(LogFilePath))
+            {
+                ALSFileLog::FailedLogFiles.Add(LogFilePath);
+                UE_LOG(LogALS, Error, TEXT("Unable to open %s for file logging. Check if the file has write permissions"), *LogFilePath);
+            }
+            return false;
+        }
+    }
+    else if (!RollOverIfNeeded(LogFilePath, FileWriter))
+    {
+        LogFileWriters.Remove(FileId);
+        return false;
+    }
+
+    FileWriter.Archive->Serialize(const_cast<uint8*>(Data), NumData);
+    if (NumWrapped > 0)
+    {
+        FileWriter.Archive->Serialize(const_cast<uint8*>(WrappedData), NumWrapped);
+    }
+
+    if (FileWriter.Archive->IsError())
+    {
+        LogFileWriters.Remove(FileId);
         return false;
     }
 
-    FString LogFilePath = UALS_Settings::Get()->FileLogRootDir.Path / GetCurrentInstance(World) + TEXT(".log");
+    if (Record.Kind == EALSRingRecordKind::Anchor)
+    {
+        FileWriter.AnchorRecord.Reset(NumData + NumWrapped);
+        FileWriter.AnchorRecord.Append(Data, NumData);
+        FileWriter.AnchorRecord.Append(WrappedData, NumWrapped);
+    }
+
+    OutTouchedFiles.Add(FileId);
+
+    ALS_STAT_ADD(FileRecords, 1);
+    ALS_STAT_ADD(FileBytes, Record.NumBytes);
+    FALSCallSiteStats::AddWritten(Record.CallSite, Record.NumBytes, Record.TimestampNs);
+    return true;
+}
+
+bool UALS_FileLog::OpenLogFileWriter(const FString& LogFilePath, FALSLogFileWriter& FileWriter, int32 SegmentIndex)
+{
+    const FString SegmentPath = FALSLogSegments::GetSegmentPath(LogFilePath, SegmentIndex);
+
+    FileWriter.Archive.Reset(IFileManager::Get().CreateFileWriter(*SegmentPath, FILEWRITE_Append | FILEWRITE_AllowRead));
+    FileWriter.SegmentIndex = SegmentIndex;
+    FileWriter.OpenedTime = FPlatformTime::Seconds();
+
+    return FileWriter.Archive.IsValid();
+}
+
+bool UALS_FileLog::RollOverIfNeeded(const FString& LogFilePath, FALSLogFileWriter& FileWriter)
+{
+    const UALS_Settings* Settings = UALS_Settings::Get();
+
+    const int64 MaxSegmentBytes = int64(Settings->LogSegmentSize) * 1024 * 1024;
+    const double MaxSegmentSeconds = Settings->LogSegmentDuration * 60.0;
+
+    const bool bSizeReached = MaxSegmentBytes > 0 && FileWriter.Archive->Tell() >= MaxSegmentBytes;
+    const bool bAgeReached = MaxSegmentSeconds > 0.0 && FPlatformTime::Seconds() - FileWriter.OpenedTime >= MaxSegmentSeconds;
+
+    if (!bSizeReached && !bAgeReached) return true;
+
+    // An empty segment is never rolled over, otherwise an idle instance would leave a trail of empty files
+    if (FileWriter.Archive->Tell() == 0) return true;
+
+    ALS_TRACE_SCOPE(RollOverLogSegment);
+
+    FileWriter.Archive.Reset();
+
+    const int32 NextSegmentIndex = FileWriter.SegmentIndex + 1;
+    if (!FALSLogSegments::AddSegment(LogFilePath, NextSegmentIndex))
+    {
+        UE_LOG(LogALS, Warning, TEXT("Failed to update the segment manifest of %s, continuing in the current segment"), *LogFilePath);
+        return OpenLogFileWriter(LogFilePath, FileWriter, FileWriter.SegmentIndex);
+    }
+
+    if (!OpenLogFileWriter(LogFilePath, FileWriter, NextSegmentIndex)) return false;
+
+    // The viewer pages through one segment at a time and needs the session's clock anchor in each of them
+    if (FileWriter.AnchorRecord.Num() > 0)
+    {
+        FileWriter.Archive->Serialize(FileWriter.AnchorRecord.GetData(), FileWriter.AnchorRecord.Num());
+    }
+
+    return !FileWriter.Archive->IsError();
+}
+
+const FALSWorldLogState& UALS_FileLog::FindOrAddWorldState(const UWorld* World)
+{
+    const ENetMode NetMode = World->GetNetMode();
+
+    FALSWorldLogState& WorldState = WorldLogStates.FindOrAdd(World);
+    if (WorldState.NetMode == NetMode && !WorldState.InstanceName.IsEmpty())
+    {
+        return WorldState;
+    }
+
+    const int32 PreviousFileId = WorldState.FileId;
+
+    // A world without a registered context yet keeps the fallback name and is resolved again on the next record
+    const bool bHasWorldContext = BuildInstanceName(World, WorldState.InstanceName);
+    WorldState.NetMode = bHasWorldContext ? NetMode : NM_MAX;
+    WorldState.LogFilePath = UALS_Settings::Get()->FileLogRootDir.Path / WorldState.InstanceName + TEXT(".log");
+    WorldState.FileId = FindOrAddLogFileId(WorldState.LogFilePath);
 
     IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    if (PlatformFile.IsReadOnly(*LogFilePath))
+    WorldState.bWritable = !PlatformFile.IsReadOnly(*WorldState.LogFilePath);
+
+    if (!WorldState.bWritable)
+    {
+        UE_LOG(LogALS, Error, TEXT("Directory not writable: %s"), *WorldState.LogFilePath);
+    }
+    else if (World->IsGameWorld())
+    {
+        ThreadLogFileId.store(WorldState.FileId, std::memory_order_release);
+    }
+
+    // A net mode change moves the world to another instance file
+    if (PreviousFileId != INDEX_NONE && PreviousFileId != WorldState.FileId)
+    {
+        ReleaseLogFileWriter(PreviousFileId);
+    }
+
+    return WorldState;
+}
+
+int32 UALS_FileLog::FindOrAddLogFileId(const FString& LogFilePath)
+{
+    const int32 ExistingId = FindLogFileId(LogFilePath);
+    if (ExistingId != INDEX_NONE)
+    {
+        return ExistingId;
+    }
+
+    FScopeLock Lock(&LogFileIdLock);
+
+    const int32 NumIds = NumLogFiles.load(std::memory_order_relaxed);
+    for (int32 FileId = 0; FileId < NumIds; ++FileId)
     {
-        UE_LOG(LogALS, Error, TEXT("Directory not writable: %s"), *LogFilePath);
+        if (LogFilePaths[FileId] == LogFilePath)
+        {
+            return FileId;
+        }
+    }
+
+    if (NumIds >= MaxLogFiles)
+    {
+        UE_LOG(LogALS, Error, TEXT("Unable to log to %s, ALS already wrote to %d different files in this run"), *LogFilePath, MaxLogFiles);
+        return INDEX_NONE;
+    }
+
+    LogFilePaths[NumIds] = LogFilePath;
+    NumLogFiles.store(NumIds + 1, std::memory_order_release);
+    return NumIds;
+}
+
+int32 UALS_FileLog::FindLogFileId(const FString& LogFilePath)
+{
+    const int32 NumIds = NumLogFiles.load(std::memory_order_acquire);
+    for (int32 FileId = 0; FileId < NumIds; ++FileId)
+    {
+        if (LogFilePaths[FileId] == LogFilePath)
+        {
+            return FileId;
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+const FString& UALS_FileLog::GetLogFilePath(int32 FileId)
+{
+    check(FileId >= 0 && FileId < NumLogFiles.load(std::memory_order_acquire));
+    return LogFilePaths[FileId];
+}
+
+bool UALS_FileLog::IsAnchored(int32 FileId)
+{
+    return AnchoredGenerations[FileId].load(std::memory_order_acquire) == SessionGeneration.load(std::memory_order_acquire);
+}
+
+void UALS_FileLog::ReleaseLogFileWriter(int32 FileId)
+{
+    for (auto It = WorldLogStates.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+        else if (It.Value().FileId == FileId)
+        {
+            // Another world still writes to the same file, keep its handle open
+            return;
+        }
+    }
+
+    EndRepeatRuns(FileId);
+
+    // Closed by the writer after the records already written for this file. The marker carries the session for the call site sidecar
+    TStringBuilder<64> SessionID;
+    SessionID.Append(GetSessionTime());
+    WriteRecord(FileId, SessionID, INDEX_NONE, 0, EALSRingRecordKind::CloseFile);
+}
+
+void UALS_FileLog::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    FScopeLock Lock(&WorldLogLock);
+
+    FALSWorldLogState RemovedState;
+    if (WorldLogStates.RemoveAndCopyValue(World, RemovedState) && RemovedState.FileId != INDEX_NONE)
+    {
+        ReleaseLogFileWriter(RemovedState.FileId);
+
+        // Context free records move on to another running world, or to the background file once none is left
+        if (ThreadLogFileId.load(std::memory_order_relaxed) == RemovedState.FileId)
+        {
+            int32 NextFileId = INDEX_NONE;
+            for (const TPair<TWeakObjectPtr<const UWorld>, FALSWorldLogState>& Pair : WorldLogStates)
+            {
+                if (Pair.Key.IsValid() && Pair.Value.bWritable && Pair.Key->IsGameWorld())
+                {
+                    NextFileId = Pair.Value.FileId;
+                }
+            }
+            ThreadLogFileId.store(NextFileId, std::memory_order_release);
+        }
+    }
+}
+
+void UALS_FileLog::FlushLogFiles()
+{
+    DrainPendingRecords();
+}
+
+void UALS_FileLog::CloseLogFiles()
+{
+    EndRepeatRuns(INDEX_NONE);
+
+    FString SessionID;
+    {
+        FScopeLock Lock(&WorldLogLock);
+
+        WorldLogStates.Reset();
+        ThreadLogFileId.store(INDEX_NONE, std::memory_order_release);
+        SessionID = CurrentSessionTime;
+    }
+
+    DrainPendingRecords();
+
+    FScopeLock Lock(&WriterLock);
+    for (const TPair<int32, FALSLogFileWriter>& Pair : LogFileWriters)
+    {
+        FALSCallSiteStats::PersistSidecar(GetLogFilePath(Pair.Key), SessionID);
+    }
+    LogFileWriters.Reset();
+}
+
+const TCHAR* UALS_FileLog::GetSeverityName(ELogSeverity LogSeverity)
+{
+    switch (LogSeverity)
+    {
+    case ELogSeverity::Info:    return TEXT("Info");
+    case ELogSeverity::Warning: return TEXT("Warning");
+    case ELogSeverity::Error:   return TEXT("Error");
+    default:                    return TEXT("Info");
+    }
+}
+
+bool UALS_FileLog::CreateSessionLog(const UWorld* World)
+{
+    if (!World)
+    {
+        UE_LOG(LogALS, Error, TEXT("No Valid World Found: Can't create Session log. Provide a valid World Context"));
         return false;
     }
 
-    uint64 CycleCounter = FPlatformTime::Cycles64();
-    FString SessionTime = GetSessionTime();
-    FString DateTimeStr = FDateTime::Now().ToString(TEXT("%Y.%m.%d-%H.%M.%S.%s"));
+    FScopeLock Lock(&WorldLogLock);
 
-    FString LogEntry = FString::Printf(
-        TEXT("%llu-|ALS|-%s-|ALS|-%s-|ALS|-[SESSION CREATED]-|ALS|-[Created a safe Play Session]\n"),
-        CycleCounter,
-        *DateTimeStr,
-        *SessionTime
-    );
+    const FALSWorldLogState& WorldState = FindOrAddWorldState(World);
+    if (!WorldState.bWritable) return false;
+
+    return WriteAnchorRecord(WorldState.FileId);
+}
+
+bool UALS_FileLog::WriteAnchorRecord(int32 FileId)
+{
+    if (FileId == INDEX_NONE) return false;
+
+    FScopeLock Lock(&WorldLogLock);
+
+    const FALSClockAnchor& Anchor = GetClockAnchor();
 
-    const bool FileLogSuccess = FFileHelper::SaveStringToFile(
-        LogEntry,
-        *LogFilePath,
-        FFileHelper::EEncodingOptions::AutoDetect,
-        &IFileManager::Get(),
-        FILEWRITE_Append
+    // The session line doubles as the clock anchor, so the viewer can place this file's timestamps on the wall clock
+    TStringBuilder<1024>& Record = ALSFileLog::GetRecordBuilder();
+    Record.Appendf(
+        TEXT("T%llu-|ALS|-A%lld:%lld:%u-|ALS|-%s-|ALS|-[SESSION CREATED]-|ALS|-[Created a safe Play Session]\n"),
+        Anchor.MonotonicNs,
+        Anchor.UtcTicks,
+        Anchor.LocalOffsetTicks,
+        Anchor.ProcessId,
+        *GetSessionTime()
     );
 
+    const bool FileLogSuccess = WriteRecord(FileId, Record, INDEX_NONE, 0, EALSRingRecordKind::Anchor);
+
     if (!FileLogSuccess)
     {
         UE_LOG(LogALS, Error, TEXT("File to create file logging. Check if the file has write permissions"));
     }
+    else
+    {
+        AnchoredGenerations[FileId].store(SessionGeneration.load(std::memory_order_relaxed), std::memory_order_release);
+    }
 
     return FileLogSuccess;
 }
@@ -128,7 +947,19 @@ FString UALS_FileLog::GetCurrentInstance(const UWorld* World)
         return FString::Printf(TEXT("%s_NoWorldContext"), FApp::GetProjectName());
     }
 
-    FString OutInstanceName = FString::Printf(TEXT("%s_Standalone (1)"), FApp::GetProjectName());
+    FScopeLock Lock(&WorldLogLock);
+    return FindOrAddWorldState(World).InstanceName;
+}
+
+FString UALS_FileLog::GetCurrentSessionID()
+{
+    FScopeLock Lock(&WorldLogLock);
+    return GetSessionTime();
+}
+
+bool UALS_FileLog::BuildInstanceName(const UWorld* World, FString& OutInstanceName)
+{
+    OutInstanceName = FString::Printf(TEXT("%s_Standalone (1)"), FApp::GetProjectName());
     int32 InstanceNumber = 0;
 
     for (const FWorldContext& Context : GEngine->GetWorldContexts())
@@ -158,17 +989,17 @@ FString UALS_FileLog::GetCurrentInstance(const UWorld* World)
                 break;
             }
 
-            break;
+            return true;
         }
     }
 
-    return OutInstanceName;
+    return false;
 }
 
 bool UALS_FileLog::IsFileBigger(const FString& LogFilePath, int32& OutFileSize)
 {
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    int64 FileSizeInBytes = PlatformFile.FileSize(*LogFilePath);
+    // Archived logs are measured by their uncompressed size, that is what the viewer has to parse
+    int64 FileSizeInBytes = FALSLogArchive::GetLogSize(LogFilePath);
     int64 MaxSizeInBytes = int64(UALS_Settings::Get()->MaxFileSizeToParse) * 1024 * 1024;
 
     const double FileSizeMiB = static_cast<double>(FileSizeInBytes) / (1024.0 * 1024.0);
@@ -184,11 +1015,21 @@ bool UALS_FileLog::IsFileBigger(const FString& LogFilePath, int32& OutFileSize)
 
 void UALS_FileLog::InitializeSessionTime()
 {
+    FScopeLock Lock(&WorldLogLock);
+
     FDateTime Now = FDateTime::Now();
-    CurrentSessionTime = Now.ToString();
+    FString NewSessionTime = Now.ToString();
+
+    if (NewSessionTime != CurrentSessionTime)
+    {
+        CurrentSessionTime = NewSessionTime;
+
+        // Every file is anchored again for the new session, and formatting threads pick up the new string
+        SessionGeneration.fetch_add(1, std::memory_order_acq_rel);
+    }
 }
 
-FString UALS_FileLog::GetSessionTime()
+const FString& UALS_FileLog::GetSessionTime()
 {
     if (CurrentSessionTime.IsEmpty())
     {
@@ -197,55 +1038,211 @@ FString UALS_FileLog::GetSessionTime()
     return CurrentSessionTime;
 }
 
+const FString& UALS_FileLog::GetThreadSessionTime()
+{
+    static thread_local FString SessionTime;
+    static thread_local uint32 CachedGeneration = 0;
+
+    if (CachedGeneration != SessionGeneration.load(std::memory_order_acquire))
+    {
+        FScopeLock Lock(&WorldLogLock);
+        SessionTime = GetSessionTime();
+        CachedGeneration = SessionGeneration.load(std::memory_order_acquire);
+    }
+
+    return SessionTime;
+}
+
+uint64 UALS_FileLog::GetMonotonicNs()
+{
+    // Whole seconds and the remainder are scaled apart in integers, a double loses nanoseconds once the counter passes 2^53
+    static const uint64 CyclesPerSecond = FMath::Max<uint64>(static_cast<uint64>(FMath::RoundToDouble(1.0 / FPlatformTime::GetSecondsPerCycle64())), 1);
+
+    const uint64 Cycles = FPlatformTime::Cycles64();
+    return (Cycles / CyclesPerSecond) * 1000000000ull + (Cycles % CyclesPerSecond) * 1000000000ull / CyclesPerSecond;
+}
+
+const FALSClockAnchor& UALS_FileLog::GetClockAnchor()
+{
+    // Captured once per process, so every instance file written by this process shares the exact same anchor
+    static const FALSClockAnchor ProcessAnchor = []()
+        {
+            FALSClockAnchor Anchor;
+            Anchor.MonotonicNs = GetMonotonicNs();
+
+            const FDateTime UtcNow = FDateTime::UtcNow();
+            const double OffsetMinutes = (FDateTime::Now() - UtcNow).GetTotalMinutes();
+
+            Anchor.UtcTicks = UtcNow.GetTicks();
+            Anchor.LocalOffsetTicks = FTimespan::FromMinutes(FMath::RoundToDouble(OffsetMinutes)).GetTicks();
+            Anchor.ProcessId = FPlatformProcess::GetCurrentProcessId();
+            return Anchor;
+        }();
+
+    return ProcessAnchor;
+}
+
+int64 FALSClockAnchor::ToUnixNs(uint64 InMonotonicNs) const
+{
+    const int64 DeltaNs = static_cast<int64>(InMonotonicNs - MonotonicNs);
+    return (UtcTicks - FDateTime(1970, 1, 1).GetTicks()) * 100 + DeltaNs;
+}
+
+FDateTime FALSClockAnchor::ToLocalTime(uint64 InMonotonicNs) const
+{
+    const int64 DeltaNs = static_cast<int64>(InMonotonicNs - MonotonicNs);
+    return FDateTime(UtcTicks + LocalOffsetTicks + DeltaNs / 100);
+}
+
+void UALS_FileLog::RotateOlderLogsAsync()
+{
+    if (!RotationTask.IsCompleted()) return;
+
+    bCancelRotation = false;
+
+    // Low priority background task, startup never waits on log housekeeping
+    RotationTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, []()
+        {
+            RotateOlderLogs();
+        },
+        UE::Tasks::ETaskPriority::BackgroundLow);
+}
+
+void UALS_FileLog::WaitForRotation()
+{
+    bCancelRotation = true;
+    RotationTask.Wait();
+}
+
 void UALS_FileLog::RotateOlderLogs()
 {
+    ALS_TRACE_SCOPE(RotateOlderLogs);
+
     IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 
     TArray<FString> InstanceFiles;
     FString LogDir = UALS_Settings::Get()->FileLogRootDir.Path;
+    FString OldLogsDir = LogDir / TEXT("ArchivedLogs");
     IFileManager::Get().FindFiles(InstanceFiles, *LogDir, TEXT(".log"));
 
+    // Housekeeping shares the disk with the running game, each instance and each compressed block is followed by a short pause
+    auto ThrottleRotation = []() -> bool
+        {
+            if (bCancelRotation) return false;
+
+            FPlatformProcess::SleepNoStats(RotationThrottleSeconds);
+            return !bCancelRotation;
+        };
+
     for (FString& FoundFile : InstanceFiles)
     {
+        if (!ThrottleRotation()) return;
+
+        // Segments are rotated together with their base log
+        if (FALSLogSegments::GetInstanceName(LogDir, FoundFile) != FPaths::GetBaseFilename(FoundFile)) continue;
+
         FString FoundFilePath = UALS_Settings::Get()->FileLogRootDir.Path / FoundFile;
 
-        FDateTime FileModTime = PlatformFile.GetTimeStamp(*FoundFilePath);
+        // The last segment is the one written most recently
+        FString LastSegmentPath = FALSLogSegments::GetSegmentPath(FoundFilePath, FALSLogSegments::GetLastSegmentIndex(FoundFilePath));
+        FDateTime FileModTime = PlatformFile.GetTimeStamp(*LastSegmentPath);
         FDateTime Now = FDateTime::Now();
 
         double AgeInDays = (Now - FileModTime).GetTotalDays();
         int32 MaxAgeInDays = UALS_Settings::Get()->MaxFileLogAge;
 
-        int64 FileSizeInBytes = PlatformFile.FileSize(*FoundFilePath);
+        int64 FileSizeInBytes = FALSLogArchive::GetLogSize(FoundFilePath);
         int64 MaxSizeInBytes = int64(UALS_Settings::Get()->MaxFileSizeToParse) * 1024 * 1024;
 
         bool bNeedsRotation = (AgeInDays >= MaxAgeInDays) || (FileSizeInBytes >= MaxSizeInBytes);
 
-        if (bNeedsRotation)
+        if (!bNeedsRotation) continue;
+
+        PlatformFile.CreateDirectoryTree(*OldLogsDir);
+
+        FString BaseFilename = FPaths::GetBaseFilename(FoundFilePath, true);
+        FString Timestamp = Now.ToString(TEXT("%Y-%m-%d_%H-%M-%S"));
+        FString NewFilePath = FString::Printf(TEXT("%s/%s_%s.log"), *OldLogsDir, *BaseFilename, *Timestamp);
+
         {
-            FString OldLogsDir = LogDir / TEXT("ArchivedLogs");
-            PlatformFile.CreateDirectoryTree(*OldLogsDir);
+            // Files already written to in this run belong to the current session and stay in place
+            FScopeLock Lock(&WorldLogLock);
+            const int32 FileId = FindLogFileId(FoundFilePath);
+            if (FileId != INDEX_NONE && IsAnchored(FileId)) continue;
 
-            FString BaseFilename = FPaths::GetBaseFilename(FoundFilePath, true);
-            FString Timestamp = Now.ToString(TEXT("%Y-%m-%d_%H-%M-%S"));
-            FString NewFilePath = FString::Printf(TEXT("%s/%s_%s.log"), *OldLogsDir, *BaseFilename, *Timestamp);
+            FScopeLock WriterScopeLock(&WriterLock);
+            if (FileId != INDEX_NONE && LogFileWriters.Contains(FileId)) continue;
 
-            if (!PlatformFile.MoveFile(*NewFilePath, *FoundFilePath))
+            if (!FALSLogSegments::MoveLog(FoundFilePath, NewFilePath))
             {
                 UE_LOG(LogALS, Warning,TEXT("Failed to rotate log file: Unable to move from %s to %s. Since the larger files are not rotated, Please manually rotate them once a while for the ALS Logs Viewer to perform well "), *FoundFilePath, *NewFilePath);
+                continue;
+            }
+
+            // The call site totals follow their log, archived instances keep their top talkers
+            const FString SidecarPath = FALSCallSiteStats::GetSidecarPath(FoundFilePath);
+            if (PlatformFile.FileExists(*SidecarPath))
+            {
+                IFileManager::Get().Move(*FALSCallSiteStats::GetSidecarPath(NewFilePath), *SidecarPath, true, true);
+            }
+        }
+
+        // Compressed outside the lock, segment by segment. If compression fails the plain archived segment is kept
+        if (UALS_Settings::Get()->bCompressArchivedLogs)
+        {
+            TArray<FString> SegmentPaths;
+            FALSLogSegments::GetSegmentPaths(NewFilePath, SegmentPaths);
+
+            for (const FString& SegmentPath : SegmentPaths)
+            {
+                FString CompressedFilePath = FPaths::ChangeExtension(SegmentPath, FALSLogArchive::ArchiveExtension);
+                if (FALSLogArchive::CompressLogFile(SegmentPath, CompressedFilePath, ThrottleRotation))
+                {
+                    PlatformFile.DeleteFile(*SegmentPath);
+                }
+
+                // A cancelled archive is deleted, the plain segment stays and is still readable
+                if (bCancelRotation) return;
             }
         }
     }
+
+    FALSLogArchive::EnforceQuota(OldLogsDir, int64(UALS_Settings::Get()->MaxArchivedLogsSize) * 1024 * 1024);
 }
 
 
-FString UALS_FileLog::EscapeForLog(const FString& InText)
+void UALS_FileLog::AppendEscapedForLog(FStringBuilderBase& OutBuilder, FStringView InText)
 {
-    FString Escaped = InText;
-    Escaped.TrimStartInline();
-    Escaped.ReplaceCharWithEscapedCharInline();
-    Escaped.ReplaceInline(TEXT("-|ALS|-"), TEXT(""));
+    // Same result as TrimStart + ReplaceCharWithEscapedChar + stripping the column separator, without the intermediate copies
+    static const FStringView Separator = TEXTVIEW("-|ALS|-");
+
+    int32 Index = 0;
+    while (Index < InText.Len() && FChar::IsWhitespace(InText[Index]))
+    {
+        Index++;
+    }
+
+    for (; Index < InText.Len(); Index++)
+    {
+        const TCHAR Char = InText[Index];
+
+        if (Char == TEXT('-') && InText.RightChop(Index).StartsWith(Separator))
+        {
+            Index += Separator.Len() - 1;
+            continue;
+        }
 
-    return Escaped;
+        switch (Char)
+        {
+        case TEXT('\\'): OutBuilder.Append(TEXT("\\\\")); break;
+        case TEXT('\n'):  OutBuilder.Append(TEXT("\\n"));  break;
+        case TEXT('\r'):  OutBuilder.Append(TEXT("\\r"));  break;
+        case TEXT('\t'):  OutBuilder.Append(TEXT("\\t"));  break;
+        case TEXT('\''):  OutBuilder.Append(TEXT("\\'"));  break;
+        case TEXT('"'):   OutBuilder.Append(TEXT("\\\""));  break;
+        default:          OutBuilder.AppendChar(Char);      break;
+        }
+    }
 }
 
 
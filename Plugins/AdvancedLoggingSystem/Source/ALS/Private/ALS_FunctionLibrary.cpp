@@ -13,73 +13,28 @@
 #include "GameFramework/Pawn.h"
 #include "Engine/GameInstance.h"
 
-void UALS_FunctionLibrary::PrintHelperEmpty()
+// Format Program
+void FALSFormatProgram::AppendLiteral(FString& Program, FStringView Literal)
 {
-    // Do nothing when the node is inactive
-}
-
-// Helper Functions
-DEFINE_FUNCTION(UALS_FunctionLibrary::execPrintHelperONE)
-{
-    P_GET_OBJECT(UObject, WorldContext);
-    P_GET_STRUCT(FLinearColor, PrintColor);
-    P_GET_PROPERTY(FFloatProperty, Duration);
-    P_GET_PROPERTY(FNameProperty, Key);
-    P_GET_PROPERTY(FByteProperty, PrintModeByte);
-    P_GET_PROPERTY(FByteProperty, LogSeverityByte);
-    P_GET_UBOOL(DrawDebug);
-    P_GET_STRUCT(FVector, TextLocation);
-    P_GET_OBJECT(UObject, BaseObject);
-    P_GET_PROPERTY(FStrProperty, SourceID);
-
-    P_GET_TARRAY(EPinType, PinTypes);
-    P_GET_TARRAY(FString, LiteralStrings);
-
-    EPrintMode OutputMode = static_cast<EPrintMode>(PrintModeByte);
-    ELogSeverity Level = static_cast<ELogSeverity>(LogSeverityByte);
-
-    if (!WorldContext)
+    for (const TCHAR Char : Literal)
     {
-        WorldContext = Stack.Object;
+        if (Char == SlotMarker)
+        {
+            Program.AppendChar(SlotMarker);
+        }
+        Program.AppendChar(Char);
     }
-
-    FString PrintString = ProcessProperty(Stack, PinTypes, LiteralStrings, 3);
-    ProcessPrint(PrintString, PrintColor, Duration, Key, OutputMode, Level, DrawDebug, TextLocation, BaseObject, WorldContext, SourceID);
-
-    P_FINISH;
 }
 
-DEFINE_FUNCTION(UALS_FunctionLibrary::execPrintHelperTWO)
+void FALSFormatProgram::AppendSlot(FString& Program, EPinType SlotType)
 {
-    P_GET_OBJECT(UObject, WorldContext);
-    P_GET_STRUCT(FLinearColor, PrintColor);
-    P_GET_PROPERTY(FFloatProperty, Duration);
-    P_GET_PROPERTY(FNameProperty, Key);
-    P_GET_PROPERTY(FByteProperty, PrintModeByte);
-    P_GET_PROPERTY(FByteProperty, LogSeverityByte);
-    P_GET_UBOOL(DrawDebug);
-    P_GET_STRUCT(FVector, TextLocation);
-    P_GET_OBJECT(UObject, BaseObject);
-    P_GET_PROPERTY(FStrProperty, SourceID);
-
-    P_GET_TARRAY(EPinType, PinTypes);
-    P_GET_TARRAY(FString, LiteralStrings);
-
-    EPrintMode OutputMode = static_cast<EPrintMode>(PrintModeByte);
-    ELogSeverity Level = static_cast<ELogSeverity>(LogSeverityByte);
-
-    if (!WorldContext)
-    {
-        WorldContext = Stack.Object;
-    }
-
-    FString PrintString = ProcessProperty(Stack, PinTypes, LiteralStrings, 5);
-    ProcessPrint(PrintString, PrintColor, Duration, Key, OutputMode, Level, DrawDebug, TextLocation, BaseObject, WorldContext, SourceID);
-
-    P_FINISH;
+    Program.AppendChar(SlotMarker);
+    Program.AppendChar(SlotType == EPinType::ObjectProperty ? ObjectSlot : PropertySlot);
 }
 
-DEFINE_FUNCTION(UALS_FunctionLibrary::execPrintHelperTHREE)
+
+// Helper Functions
+DEFINE_FUNCTION(UALS_FunctionLibrary::execPrintHelperProgram)
 {
     P_GET_OBJECT(UObject, WorldContext);
     P_GET_STRUCT(FLinearColor, PrintColor);
@@ -91,9 +46,7 @@ DEFINE_FUNCTION(UALS_FunctionLibrary::execPrintHelperTHREE)
     P_GET_STRUCT(FVector, TextLocation);
     P_GET_OBJECT(UObject, BaseObject);
     P_GET_PROPERTY(FStrProperty, SourceID);
-
-    P_GET_TARRAY(EPinType, PinTypes);
-    P_GET_TARRAY(FString, LiteralStrings);
+    P_GET_PROPERTY_REF(FStrProperty, FormatProgram);
 
     EPrintMode OutputMode = static_cast<EPrintMode>(PrintModeByte);
     ELogSeverity Level = static_cast<ELogSeverity>(LogSeverityByte);
@@ -103,138 +56,95 @@ DEFINE_FUNCTION(UALS_FunctionLibrary::execPrintHelperTHREE)
         WorldContext = Stack.Object;
     }
 
-    FString PrintString = ProcessProperty(Stack, PinTypes, LiteralStrings, 7);
-    ProcessPrint(PrintString, PrintColor, Duration, Key, OutputMode, Level, DrawDebug, TextLocation, BaseObject, WorldContext, SourceID);
-
-    P_FINISH;
-}
-
-DEFINE_FUNCTION(UALS_FunctionLibrary::execPrintHelperFOUR)
-{
-    P_GET_OBJECT(UObject, WorldContext);
-    P_GET_STRUCT(FLinearColor, PrintColor);
-    P_GET_PROPERTY(FFloatProperty, Duration);
-    P_GET_PROPERTY(FNameProperty, Key);
-    P_GET_PROPERTY(FByteProperty, PrintModeByte);
-    P_GET_PROPERTY(FByteProperty, LogSeverityByte);
-    P_GET_UBOOL(DrawDebug);
-    P_GET_STRUCT(FVector, TextLocation);
-    P_GET_OBJECT(UObject, BaseObject);
-    P_GET_PROPERTY(FStrProperty, SourceID);
-
-    P_GET_TARRAY(EPinType, PinTypes);
-    P_GET_TARRAY(FString, LiteralStrings);
-
-    EPrintMode OutputMode = static_cast<EPrintMode>(PrintModeByte);
-    ELogSeverity Level = static_cast<ELogSeverity>(LogSeverityByte);
+    TStringBuilder<256> PrintString;
+    ExecuteFormatProgram(Stack, FormatProgram, PrintString, FPrintConfig().FloatPrecision);
 
-    if (!WorldContext)
+    // Values the program did not consume still have to be stepped over
+    while (Stack.PeekCode() != EX_EndFunctionParms)
     {
-        WorldContext = Stack.Object;
+        Stack.StepCompiledIn<FProperty>(nullptr);
     }
 
-    FString PrintString = ProcessProperty(Stack, PinTypes, LiteralStrings, 10);
-    ProcessPrint(PrintString, PrintColor, Duration, Key, OutputMode, Level, DrawDebug, TextLocation, BaseObject, WorldContext, SourceID);
-
     P_FINISH;
+
+    ProcessPrint(FString(PrintString.ToView()), PrintColor, Duration, Key, OutputMode, Level, DrawDebug, TextLocation, BaseObject, WorldContext, SourceID);
 }
 
 
 // Helper Processing
-FString UALS_FunctionLibrary::ProcessProperty(FFrame& Stack, TArray<EPinType>& PinTypes, TArray<FString>& LiteralStrings, int32 MaxValue)
+void UALS_FunctionLibrary::ExecuteFormatProgram(FFrame& Stack, const FString& FormatProgram, FStringBuilderBase& OutValue, int32 FloatPrecision)
 {
-    TArray<FString> CollectedStrings;
-    CollectedStrings.Reserve(PinTypes.Num());
-
-    int32 ProcessedStack = 0;
+    const TCHAR* Program = *FormatProgram;
+    const int32 ProgramLen = FormatProgram.Len();
 
-    TStringBuilder<256> OutValue;
-    for (int32 i = 0; i < PinTypes.Num(); i++)
+    int32 LiteralStart = 0;
+    for (int32 i = 0; i < ProgramLen; i++)
     {
-        switch (PinTypes[i])
+        if (Program[i] != FALSFormatProgram::SlotMarker)
         {
-        case EPinType::OtherProperty:
-        {
-            if (ProcessedStack >= MaxValue)
-            {
-                return TEXT("Trying to access invalid number of stack");
-            }
-
-            Stack.StepCompiledIn<FProperty>(nullptr);
+            continue;
+        }
 
-            FProperty* ValueProperty = Stack.MostRecentProperty;
-            const void* ValuePtr = Stack.MostRecentPropertyAddress;
+        OutValue.Append(Program + LiteralStart, i - LiteralStart);
 
-            if (!ValueProperty || !ValuePtr)
-            {
-                UE_LOG(LogALS, Error, TEXT("Invalid Stack Address or Property"));
-                OutValue.Appendf(TEXT("Invalid Stack Address or Property"));
-                continue;
-            }
+        const TCHAR Op = i + 1 < ProgramLen ? Program[i + 1] : TCHAR(0);
+        i++;
+        LiteralStart = FMath::Min(i + 1, ProgramLen);
 
-            UALS_Globals::ConvertToString_Property(ValueProperty, ValuePtr, OutValue);
-
-            ProcessedStack++;
-            break;
+        if (Op == FALSFormatProgram::SlotMarker)
+        {
+            OutValue.AppendChar(FALSFormatProgram::SlotMarker);
+            continue;
         }
 
-        case EPinType::ObjectProperty:
+        if (Op != FALSFormatProgram::ObjectSlot && Op != FALSFormatProgram::PropertySlot)
         {
-            if (ProcessedStack >= MaxValue)
-            {
-                return TEXT("Trying to access invalid number of stack");
-            }
-
-            P_GET_OBJECT(UObject, ConnectedObject);
-
-            if (ConnectedObject)
-            {
-                OutValue.Append(UALS_Globals::GetDisplayNameSafe(ConnectedObject));
-            }
-            else
-            {
-                OutValue.Append(TEXT("null_object"));
-            }
-
-            ProcessedStack++;
-            break;
+            UE_LOG(LogALS, Warning, TEXT("Unknown slot in ALS format program"));
+            continue;
         }
 
-        case EPinType::UnHandled:
+        if (Stack.PeekCode() == EX_EndFunctionParms)
         {
-            if (ProcessedStack >= MaxValue)
-            {
-                return TEXT("Trying to access invalid number of stack");
-            }
+            UE_LOG(LogALS, Error, TEXT("ALS format program expects more values than were passed"));
+            OutValue.Append(TEXT("Trying to access invalid number of stack"));
+            return;
+        }
+
+        Stack.MostRecentProperty = nullptr;
+        Stack.MostRecentPropertyAddress = nullptr;
+        Stack.StepCompiledIn<FProperty>(nullptr);
 
-            P_GET_PROPERTY(FStrProperty, DummyValue);
+        FProperty* ValueProperty = Stack.MostRecentProperty;
+        const void* ValuePtr = Stack.MostRecentPropertyAddress;
 
-            ProcessedStack++;
-            break;
+        if (!ValueProperty || !ValuePtr)
+        {
+            UE_LOG(LogALS, Error, TEXT("Invalid Stack Address or Property"));
+            OutValue.Append(TEXT("Invalid Stack Address or Property"));
+            continue;
         }
 
-        case EPinType::UnConnected:
+        if (Op == FALSFormatProgram::ObjectSlot)
         {
-            if (LiteralStrings.IsValidIndex(i))
+            const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(ValueProperty);
+            UObject* ConnectedObject = ObjectProperty ? ObjectProperty->GetObjectPropertyValue(ValuePtr) : nullptr;
+
+            if (ConnectedObject)
             {
-                OutValue.Append(LiteralStrings[i]);
+                OutValue.Append(UALS_Globals::GetDisplayNameSafe(ConnectedObject));
             }
             else
             {
-                OutValue.Append(TEXT(""));
+                OutValue.Append(TEXT("null_object"));
             }
-            break;
         }
-
-        default:
+        else
         {
-            UE_LOG(LogALS, Warning, TEXT("Unknown EPinType in PrintHelper"));
-            break;
-        }
+            UALS_Globals::ConvertToString_Property(ValueProperty, ValuePtr, OutValue, FloatPrecision);
         }
     }
 
-    return OutValue.ToString();
+    OutValue.Append(Program + LiteralStart, ProgramLen - LiteralStart);
 }
 
 void UALS_FunctionLibrary::ProcessPrint(const FString& PrintString, const FLinearColor& PrintColor, const float& Duration, const FName Key, const EPrintMode& PrintMode, const ELogSeverity& LogSeverity, const bool& DrawDebug, const FVector& TextLocation, const UObject* BaseObject, const UObject* Context, const FString& SourceID)
@@ -2,7 +2,22 @@
 
 #include "ALS_Globals.h"
 #include "ALS_FileLog.h"
+#include "ALS_ScreenLog.h"
+#include "ALS_WorldText.h"
+#include "ALS_Trace.h"
+#include "ALS_Stats.h"
+#include "ALS_NumberFormat.h"
 #include "GameplayTagContainer.h"
+#include "Containers/Ticker.h"
+#include "HAL/ThreadManager.h"
+
+FStringBuilderBase& UALS_Globals::GetFormatBuilder()
+{
+    // Keeps its grown buffer for the lifetime of the thread, steady state formatting only allocates the final message
+    static thread_local TStringBuilder<1024> FormatBuilder;
+    FormatBuilder.Reset();
+    return FormatBuilder;
+}
 
 FString UALS_Globals::GetNetworkContextTag(const UObject* Context)
 {
@@ -53,7 +68,7 @@ void UALS_Globals::ConvertToString_Byte(FByteProperty* ByteProperty, const void*
     }
 }
 
-void UALS_Globals::ConvertToString_Array(FScriptArrayHelper& ArrayHelper, FArrayProperty* ArrayProperty, FStringBuilderBase& OutBuilder)
+void UALS_Globals::ConvertToString_Array(FScriptArrayHelper& ArrayHelper, FArrayProperty* ArrayProperty, FStringBuilderBase& OutBuilder, int32 FloatPrecision)
 {
     if (ArrayHelper.Num() == 0)
     {
@@ -66,12 +81,14 @@ void UALS_Globals::ConvertToString_Array(FScriptArrayHelper& ArrayHelper, FArray
         void* ElementPtr = ArrayHelper.GetRawPtr(i);
         FProperty* ElementProperty = ArrayProperty->Inner;
 
-        OutBuilder.Appendf(TEXT("\n%d -> "), i);
-        ConvertToString_Property(ElementProperty, ElementPtr, OutBuilder);
+        OutBuilder.Append(TEXT("\n"));
+        FALSNumberFormat::AppendInt(OutBuilder, i);
+        OutBuilder.Append(TEXT(" -> "));
+        ConvertToString_Property(ElementProperty, ElementPtr, OutBuilder, FloatPrecision);
     }
 }
 
-void UALS_Globals::ConvertToString_Set(FScriptSetHelper& SetHelper, FSetProperty* SetProperty, FStringBuilderBase& OutBuilder)
+void UALS_Globals::ConvertToString_Set(FScriptSetHelper& SetHelper, FSetProperty* SetProperty, FStringBuilderBase& OutBuilder, int32 FloatPrecision)
 {
     if (SetHelper.Num() == 0)
     {
@@ -86,12 +103,14 @@ void UALS_Globals::ConvertToString_Set(FScriptSetHelper& SetHelper, FSetProperty
         void* ElementPtr = SetHelper.GetElementPtr(i);
         FProperty* ElementProperty = SetProperty->ElementProp;
 
-        OutBuilder.Appendf(TEXT("\n%d -> "), i);
-        ConvertToString_Property(ElementProperty, ElementPtr, OutBuilder);
+        OutBuilder.Append(TEXT("\n"));
+        FALSNumberFormat::AppendInt(OutBuilder, i);
+        OutBuilder.Append(TEXT(" -> "));
+        ConvertToString_Property(ElementProperty, ElementPtr, OutBuilder, FloatPrecision);
     }
 }
 
-void UALS_Globals::ConvertToString_Map(FScriptMapHelper& MapHelper, FMapProperty* MapProperty, FStringBuilderBase& OutBuilder)
+void UALS_Globals::ConvertToString_Map(FScriptMapHelper& MapHelper, FMapProperty* MapProperty, FStringBuilderBase& OutBuilder, int32 FloatPrecision)
 {
     if (MapHelper.Num() == 0)
     {
@@ -110,14 +129,14 @@ void UALS_Globals::ConvertToString_Map(FScriptMapHelper& MapHelper, FMapProperty
         FProperty* ValueProperty = MapProperty->ValueProp;
 
         OutBuilder.Appendf(TEXT("\n%d -> [K: "), i);
-        ConvertToString_Property(KeyProperty, KeyPtr, OutBuilder);
+        ConvertToString_Property(KeyProperty, KeyPtr, OutBuilder, FloatPrecision);
         OutBuilder.Append(TEXT(", V: "));
-        ConvertToString_Property(ValueProperty, ValuePtr, OutBuilder);
+        ConvertToString_Property(ValueProperty, ValuePtr, OutBuilder, FloatPrecision);
         OutBuilder.Append(TEXT("]"));
     }
 }
 
-bool UALS_Globals::FormatInlineStruct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder)
+bool UALS_Globals::FormatInlineStruct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder, int32 FloatPrecision)
 {
     if (StructType == TBaseStructure<FVector>::Get() ||
         StructType == TBaseStructure<FVector_NetQuantize>::Get() ||
@@ -126,35 +145,35 @@ bool UALS_Globals::FormatInlineStruct(const UScriptStruct* StructType, const voi
         StructType == TBaseStructure<FVector_NetQuantizeNormal>::Get())
     {
         const FVector Vec = *static_cast<const FVector*>(StructPtr);
-        OutBuilder.Appendf(TEXT("X: %.2f, Y: %.2f, Z: %.2f"), Vec.X, Vec.Y, Vec.Z);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: "), TEXT(", Z: ") }, { Vec.X, Vec.Y, Vec.Z }, FloatPrecision);
         return true;
     }
 
     if (StructType == TBaseStructure<FVector2D>::Get())
     {
         const FVector2D Vec = *static_cast<const FVector2D*>(StructPtr);
-        OutBuilder.Appendf(TEXT("X: %.2f, Y: %.2f"), Vec.X, Vec.Y);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: ") }, { Vec.X, Vec.Y }, FloatPrecision);
         return true;
     }
 
     if (StructType == TBaseStructure<FVector4>::Get())
     {
         const FVector4 Vec = *static_cast<const FVector4*>(StructPtr);
-        OutBuilder.Appendf(TEXT("X: %.2f, Y: %.2f, Z: %.2f, W: %.2f"), Vec.X, Vec.Y, Vec.Z, Vec.W);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: "), TEXT(", Z: "), TEXT(", W: ") }, { Vec.X, Vec.Y, Vec.Z, Vec.W }, FloatPrecision);
         return true;
     }
 
     if (StructType == TBaseStructure<FRotator>::Get())
     {
         const FRotator Rot = *static_cast<const FRotator*>(StructPtr);
-        OutBuilder.Appendf(TEXT("P: %.6f, Y: %.6f, R: %.6f"), Rot.Pitch, Rot.Yaw, Rot.Roll);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("P: "), TEXT(", Y: "), TEXT(", R: ") }, { Rot.Pitch, Rot.Yaw, Rot.Roll }, FloatPrecision);
         return true;
     }
 
     if (StructType == TBaseStructure<FQuat>::Get())
     {
         const FQuat Quat = *static_cast<const FQuat*>(StructPtr);
-        OutBuilder.Appendf(TEXT("X: %.6f, Y: %.6f, Z: %.6f, W: %.6f"), Quat.X, Quat.Y, Quat.Z, Quat.W);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: "), TEXT(", Z: "), TEXT(", W: ") }, { Quat.X, Quat.Y, Quat.Z, Quat.W }, FloatPrecision);
         return true;
     }
 
@@ -165,15 +184,16 @@ bool UALS_Globals::FormatInlineStruct(const UScriptStruct* StructType, const voi
         const FRotator Rot = Transform.Rotator();
         const FVector Scale = Transform.GetScale3D();
 
-        OutBuilder.Appendf(TEXT("[Location] X: %.3f, Y: %.3f, Z: %.3f -- [Rotation] P: %.6f, Y: %.6f, R: %.6f -- [Scale] X: %.3f, Y: %.3f, Z: %.3f"),
-            Loc.X, Loc.Y, Loc.Z, Rot.Pitch, Rot.Yaw, Rot.Roll, Scale.X, Scale.Y, Scale.Z);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("[Location] X: "), TEXT(", Y: "), TEXT(", Z: ") }, { Loc.X, Loc.Y, Loc.Z }, FloatPrecision);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT(" -- [Rotation] P: "), TEXT(", Y: "), TEXT(", R: ") }, { Rot.Pitch, Rot.Yaw, Rot.Roll }, FloatPrecision);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT(" -- [Scale] X: "), TEXT(", Y: "), TEXT(", Z: ") }, { Scale.X, Scale.Y, Scale.Z }, FloatPrecision);
         return true;
     }
 
     if (StructType == TBaseStructure<FLinearColor>::Get())
     {
         const FLinearColor Color = *static_cast<const FLinearColor*>(StructPtr);
-        OutBuilder.Appendf(TEXT("R: %.2f, G: %.2f, B: %.2f, A: %.2f"), Color.R, Color.G, Color.B, Color.A);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("R: "), TEXT(", G: "), TEXT(", B: "), TEXT(", A: ") }, { Color.R, Color.G, Color.B, Color.A }, FloatPrecision);
         return true;
     }
 
@@ -245,10 +265,9 @@ bool UALS_Globals::FormatInlineStruct(const UScriptStruct* StructType, const voi
     {
         const FBoxSphereBounds* B = reinterpret_cast<const FBoxSphereBounds*>(StructPtr);
 
-        OutBuilder.Appendf(TEXT("Origin:[%.2f %.2f %.2f]  Extent:[%.2f %.2f %.2f]  Radius:%.2f"),
-            B->Origin.X, B->Origin.Y, B->Origin.Z,
-            B->BoxExtent.X, B->BoxExtent.Y, B->BoxExtent.Z,
-            B->SphereRadius);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("Origin:["), TEXT(" "), TEXT(" ") }, { B->Origin.X, B->Origin.Y, B->Origin.Z }, FloatPrecision);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("]  Extent:["), TEXT(" "), TEXT(" ") }, { B->BoxExtent.X, B->BoxExtent.Y, B->BoxExtent.Z }, FloatPrecision);
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("]  Radius:") }, { B->SphereRadius }, FloatPrecision);
         return true;
     }
     if (StructType == TBaseStructure<FCollisionProfileName>::Get())
@@ -304,7 +323,8 @@ bool UALS_Globals::FormatInlineStruct(const UScriptStruct* StructType, const voi
     if (StructType == TBaseStructure<FFloatRange>::Get())
     {
         const FFloatRange& R = *static_cast<const FFloatRange*>(StructPtr);
-        OutBuilder.Appendf(TEXT("[%.3f – %.3f]"), R.GetLowerBoundValue(), R.GetUpperBoundValue());
+        FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("["), TEXT(" – ") }, { R.GetLowerBoundValue(), R.GetUpperBoundValue() }, FloatPrecision);
+        OutBuilder.Append(TEXT("]"));
         return true;
     }
 
@@ -360,7 +380,7 @@ bool UALS_Globals::FormatInlineStruct(const UScriptStruct* StructType, const voi
     return false;
 }
 
-void UALS_Globals::ConvertToString_Struct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder)
+void UALS_Globals::ConvertToString_Struct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder, int32 FloatPrecision)
 {
     if (!StructType || !StructPtr)
     {
@@ -368,7 +388,7 @@ void UALS_Globals::ConvertToString_Struct(const UScriptStruct* StructType, const
         return;
     }
 
-    if (FormatInlineStruct(StructType, StructPtr, OutBuilder))
+    if (FormatInlineStruct(StructType, StructPtr, OutBuilder, FloatPrecision))
     {
         return;
     }
@@ -383,7 +403,7 @@ void UALS_Globals::ConvertToString_Struct(const UScriptStruct* StructType, const
         OutBuilder.Append(TEXT("\n"));
         OutBuilder.Append(Property->GetAuthoredName());
         OutBuilder.Append(TEXT(":- "));
-        ConvertToString_Property(Property, ValuePtr, OutBuilder);
+        ConvertToString_Property(Property, ValuePtr, OutBuilder, FloatPrecision);
         bHasValues = true;
     }
 
@@ -393,8 +413,10 @@ void UALS_Globals::ConvertToString_Struct(const UScriptStruct* StructType, const
     }
 }
 
-void UALS_Globals::ConvertToString_Property(FProperty* Property, const void* ValuePtr, FStringBuilderBase& OutBuilder)
+void UALS_Globals::ConvertToString_Property(FProperty* Property, const void* ValuePtr, FStringBuilderBase& OutBuilder, int32 FloatPrecision)
 {
+    ALS_TRACE_SCOPE(ConvertToString_Property);
+
     if (!Property)
     {
         OutBuilder.Append(TEXT("[Invalid Property]"));
@@ -407,22 +429,22 @@ void UALS_Globals::ConvertToString_Property(FProperty* Property, const void* Val
     }
     else if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
     {
-        ConvertToString_Struct(StructProp->Struct, ValuePtr, OutBuilder);
+        ConvertToString_Struct(StructProp->Struct, ValuePtr, OutBuilder, FloatPrecision);
     }
     else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
     {
         FScriptArrayHelper ArrayHelper(ArrayProp, ValuePtr);
-        ConvertToString_Array(ArrayHelper, ArrayProp, OutBuilder);
+        ConvertToString_Array(ArrayHelper, ArrayProp, OutBuilder, FloatPrecision);
     }
     else if (FSetProperty* SetProp = CastField<FSetProperty>(Property))
     {
         FScriptSetHelper SetHelper(SetProp, ValuePtr);
-        ConvertToString_Set(SetHelper, SetProp, OutBuilder);
+        ConvertToString_Set(SetHelper, SetProp, OutBuilder, FloatPrecision);
     }
     else if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
     {
         FScriptMapHelper MapHelper(MapProp, ValuePtr);
-        ConvertToString_Map(MapHelper, MapProp, OutBuilder);
+        ConvertToString_Map(MapHelper, MapProp, OutBuilder, FloatPrecision);
     }
     else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
     {
@@ -473,14 +495,45 @@ void UALS_Globals::LogOutput(const FString& Value, ELogSeverity Level)
     }
 }
 
+const UALS_Globals::FContextStrings& UALS_Globals::FindOrAddContextStrings(const UObject* InContext)
+{
+    // Only actors carry a network tag, see GetNetworkContextTag
+    const AActor* Actor = Cast<const AActor>(InContext);
+    const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    const ENetMode NetMode = World ? World->GetNetMode() : NM_MAX;
+
+    FContextStrings& Cached = ContextCache.FindOrAdd(InContext);
+    if (Cached.Caller.IsEmpty() || Cached.NetMode != NetMode)
+    {
+        Cached.NetMode = NetMode;
+        Cached.Network = GetNetworkContextTag(InContext);
+        Cached.Caller = FString::Printf(TEXT("%s[%s]"), *Cached.Network, *InContext->GetName().Replace(TEXT("_C_"), TEXT(" #")));
+    }
+
+    return Cached;
+}
+
+void UALS_Globals::AppendContextCaller(const UObject* InContext, FStringBuilderBase& OutCaller)
+{
+    if (!InContext)
+    {
+        OutCaller.Append(TEXT("[NoContext]"));
+        return;
+    }
+
+    FScopeLock Lock(&ContextCacheLock);
+    OutCaller.Append(FindOrAddContextStrings(InContext).Caller);
+}
+
 void UALS_Globals::GetContextAndNetwork(const UObject* InContext, FString& OutCaller, FString& OutNetwork)
 {
     if (InContext)
     {
-        OutCaller = InContext->GetName().Replace(TEXT("_C_"), TEXT(" #"));
-        OutNetwork = GetNetworkContextTag(InContext);
+        FScopeLock Lock(&ContextCacheLock);
 
-        OutCaller = FString::Printf(TEXT("%s[%s]"), *OutNetwork, *OutCaller);
+        const FContextStrings& Cached = FindOrAddContextStrings(InContext);
+        OutCaller = Cached.Caller;
+        OutNetwork = Cached.Network;
     }
     else
     {
@@ -490,6 +543,20 @@ void UALS_Globals::GetContextAndNetwork(const UObject* InContext, FString& OutCa
     return;
 }
 
+void UALS_Globals::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    FScopeLock Lock(&ContextCacheLock);
+
+    for (auto It = ContextCache.CreateIterator(); It; ++It)
+    {
+        const UObject* Object = It.Key().Get();
+        if (!Object || Object->GetWorld() == World)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
 void UALS_Globals::PrintALS(
     const FString& Value, 
     const FPrintConfig& PrintConfig, 
@@ -498,12 +565,25 @@ void UALS_Globals::PrintALS(
     bool InitiateFileLog
 )
 {
+    // Objects and the engine's screen messages belong to the game thread, other threads only keep the message itself
+    if (!IsInGameThread())
+    {
+        PrintALSAnyThread(Value, PrintConfig, SourceID, InitiateFileLog);
+        return;
+    }
+
+    ALS_TRACE_SCOPE(PrintALS);
+    ALS_STAT_SCOPE(Print);
+    ALS_STAT_ADD(Messages, 1);
+
     FColor PrintColor = PrintConfig.Color;
 
     FString Caller;
     FString Network;
     GetContextAndNetwork(Context, Caller, Network);
 
+    FALSTrace::OutputMessage(SourceID, Caller, PrintConfig.LogSeverity, Value);
+
     FString ValueWithContextAndNetwork = FString::Printf(TEXT("%s %s"), *Caller, *Value);
     FString ValueWithNetwork = FString::Printf(TEXT("%s%s"), *Network, *Value);
 
@@ -512,13 +592,16 @@ void UALS_Globals::PrintALS(
 
     if (PrintConfig.PrintMode == EPrintMode::ScreenOnly || PrintConfig.PrintMode == EPrintMode::ScreenAndLog)
     {
-        uint64 InnerKey = -1;
-        if (PrintConfig.Key != NAME_None)
+        if (!UALS_ScreenLogSubsystem::AddMessage(Context, SourceID, Screen, PrintConfig.Key, PrintConfig.Duration, PrintColor))
         {
-            InnerKey = GetTypeHash(PrintConfig.Key);
-        }
+            uint64 InnerKey = -1;
+            if (PrintConfig.Key != NAME_None)
+            {
+                InnerKey = GetTypeHash(PrintConfig.Key);
+            }
 
-        GEngine->AddOnScreenDebugMessage(InnerKey, PrintConfig.Duration, PrintColor, *Screen);
+            GEngine->AddOnScreenDebugMessage(InnerKey, PrintConfig.Duration, PrintColor, *Screen);
+        }
     }
 
     if (InitiateFileLog)
@@ -528,10 +611,100 @@ void UALS_Globals::PrintALS(
             LogOutput(Log, PrintConfig.LogSeverity);
         }
 
-        UALS_FileLog::CreateMessageLog(Context, SourceID, Value, PrintConfig.LogSeverity);      
+        if (Context)
+        {
+            UALS_FileLog::CreateMessageLog(Context, SourceID, Value, PrintConfig.LogSeverity);
+        }
+        else
+        {
+            UALS_FileLog::CreateThreadMessageLog(Caller, SourceID, PrintConfig.LogSeverity, Value);
+        }
+    }
+}
+
+void UALS_Globals::PrintALSAnyThread(const FString& Value, const FPrintConfig& PrintConfig, const FString& SourceID, bool InitiateFileLog)
+{
+    ALS_TRACE_SCOPE(PrintALS);
+    ALS_STAT_SCOPE(Print);
+    ALS_STAT_ADD(Messages, 1);
+
+    const FString& Caller = GetThreadCaller();
+
+    FALSTrace::OutputMessage(SourceID, Caller, PrintConfig.LogSeverity, Value);
+
+    if (PrintConfig.PrintMode == EPrintMode::ScreenOnly || PrintConfig.PrintMode == EPrintMode::ScreenAndLog)
+    {
+        FPendingScreenPrint ScreenPrint;
+        ScreenPrint.SourceID = SourceID;
+        ScreenPrint.Text = UALS_Settings::Get()->bShowCallerName ? FString::Printf(TEXT("%s %s"), *Caller, *Value) : Value;
+        ScreenPrint.Key = PrintConfig.Key;
+        ScreenPrint.Duration = PrintConfig.Duration;
+        ScreenPrint.Color = PrintConfig.Color;
+
+        PendingScreenPrints.Enqueue(MoveTemp(ScreenPrint));
+        INC_DWORD_STAT(STAT_ALS_PendingScreenPrints);
+
+        // One ticker for everything queued until the next frame, not one game thread task per print
+        if (!bScreenFlushScheduled.exchange(true))
+        {
+            FTSTicker::GetCoreTicker().AddTicker(TEXT("ALSScreenPrints"), 0.0f, [](float DeltaTime)
+                {
+                    FlushPendingScreenPrints();
+                    return false;
+                });
+        }
+    }
+
+    if (InitiateFileLog)
+    {
+        if (PrintConfig.PrintMode == EPrintMode::LogOnly || PrintConfig.PrintMode == EPrintMode::ScreenAndLog)
+        {
+            LogOutput(FString::Printf(TEXT("%s %s"), *Caller, *Value), PrintConfig.LogSeverity);
+        }
+
+        UALS_FileLog::CreateThreadMessageLog(Caller, SourceID, PrintConfig.LogSeverity, Value);
     }
 }
 
+void UALS_Globals::FlushPendingScreenPrints()
+{
+    // Cleared first, a print queued while this drains schedules the next frame instead of being missed
+    bScreenFlushScheduled = false;
+
+    UWorld* PlayWorld = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr;
+
+    FPendingScreenPrint ScreenPrint;
+    while (PendingScreenPrints.Dequeue(ScreenPrint))
+    {
+        DEC_DWORD_STAT(STAT_ALS_PendingScreenPrints);
+
+        if (!UALS_ScreenLogSubsystem::AddMessage(PlayWorld, ScreenPrint.SourceID, ScreenPrint.Text, ScreenPrint.Key, ScreenPrint.Duration, ScreenPrint.Color) && GEngine)
+        {
+            uint64 InnerKey = -1;
+            if (ScreenPrint.Key != NAME_None)
+            {
+                InnerKey = GetTypeHash(ScreenPrint.Key);
+            }
+
+            GEngine->AddOnScreenDebugMessage(InnerKey, ScreenPrint.Duration, ScreenPrint.Color, *ScreenPrint.Text);
+        }
+    }
+}
+
+const FString& UALS_Globals::GetThreadCaller()
+{
+    static thread_local FString ThreadCaller;
+
+    if (ThreadCaller.IsEmpty())
+    {
+        const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+        const FString& ThreadName = FThreadManager::GetThreadName(ThreadId);
+        ThreadCaller = FString::Printf(TEXT("[%s #%u]"), ThreadName.IsEmpty() ? TEXT("Thread") : *ThreadName, ThreadId);
+    }
+
+    return ThreadCaller;
+}
+
 void UALS_Globals::DrawALS(
     const FString& Value, 
     const UObject* BaseObject, 
@@ -541,6 +714,17 @@ void UALS_Globals::DrawALS(
     const FString& SourceID,
     bool InitiateFileLog)
 {
+    // World text needs the game thread, off it the draw keeps only its message
+    if (!IsInGameThread())
+    {
+        PrintALSAnyThread(Value, PrintConfig, SourceID, InitiateFileLog);
+        return;
+    }
+
+    ALS_TRACE_SCOPE(DrawALS);
+    ALS_STAT_SCOPE(Draw);
+    ALS_STAT_ADD(Messages, 1);
+
     UWorld* World = nullptr;
 
     if (Context)
@@ -578,21 +762,28 @@ void UALS_Globals::DrawALS(
     FString Network;
     GetContextAndNetwork(Context, Caller, Network);
 
+    FALSTrace::OutputMessage(SourceID, Caller, PrintConfig.LogSeverity, Value);
+
     FString ValueWithContextAndNetwork = FString::Printf(TEXT("%s %s"), *Caller, *Value);
     FString ValueWithNetwork = FString::Printf(TEXT("%s%s"), *Network, *Value);
 
     FString Screen = UALS_Settings::Get()->bShowCallerName ? ValueWithContextAndNetwork : ValueWithNetwork;
     FString Log = ValueWithContextAndNetwork;
 
-    DrawDebugString(
-        World,
-        FinalLocation,
-        Screen,
-        nullptr,
-        PrintConfig.Color,
-        PrintConfig.Duration,
-        true
-    );
+    // Repeated draws from the same source for the same object update one slot instead of adding a debug string each time
+    const UObject* Target = BaseObject ? BaseObject : Context;
+    if (!UALS_WorldTextSubsystem::AddText(World, Target, BaseObject, TextLocation, SourceID, Screen, PrintConfig.Duration, PrintConfig.Color))
+    {
+        DrawDebugString(
+            World,
+            FinalLocation,
+            Screen,
+            nullptr,
+            PrintConfig.Color,
+            PrintConfig.Duration,
+            true
+        );
+    }
 
     if (InitiateFileLog)
     {
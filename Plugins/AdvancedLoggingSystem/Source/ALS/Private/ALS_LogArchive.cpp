@@ -0,0 +1,334 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_LogArchive.h"
+#include "ALS_LogSegments.h"
+#include "ALS_Definitions.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Algo/Sort.h"
+
+namespace ALSLogArchive
+{
+    static constexpr uint32 Magic = 0x5A534C41; // "ALSZ"
+    static constexpr uint32 Version = 1;
+    static constexpr int32 BlockSize = 256 * 1024;
+
+    static FName GetCompressionFormat()
+    {
+        return FCompression::IsFormatValid(NAME_Oodle) ? NAME_Oodle : NAME_Zlib;
+    }
+
+    // Decompresses one block at a time, memory stays at two blocks no matter how large the archive is
+    class FCompressedLogReader : public FArchive
+    {
+    public:
+        explicit FCompressedLogReader(FArchive* InInner)
+            : Inner(InInner)
+        {
+            SetIsLoading(true);
+            SetIsPersistent(true);
+
+            if (!Inner.IsValid()) return;
+
+            uint32 FileMagic = 0;
+            uint32 FileVersion = 0;
+            FString FormatString;
+
+            *Inner << FileMagic << FileVersion << FormatString << UncompressedSize;
+
+            FormatName = FName(*FormatString);
+            bValidHeader = !Inner->IsError() && FileMagic == Magic && FileVersion == Version && FCompression::IsFormatValid(FormatName);
+            FirstBlockOffset = Inner->Tell();
+        }
+
+        bool IsValidHeader() const { return bValidHeader; }
+
+        virtual void Serialize(void* Data, int64 Num) override
+        {
+            uint8* Out = static_cast<uint8*>(Data);
+
+            while (Num > 0)
+            {
+                if (BlockPos >= Block.Num() && !ReadBlock())
+                {
+                    FMemory::Memzero(Out, Num);
+                    SetError();
+                    return;
+                }
+
+                const int64 CopySize = FMath::Min<int64>(Num, Block.Num() - BlockPos);
+                FMemory::Memcpy(Out, Block.GetData() + BlockPos, CopySize);
+
+                Out += CopySize;
+                Num -= CopySize;
+                BlockPos += static_cast<int32>(CopySize);
+                Position += CopySize;
+            }
+        }
+
+        // Blocks before the position are skipped by their packed size, only the block holding it is decompressed
+        virtual void Seek(int64 InPos) override
+        {
+            const int64 BlockStart = Position - BlockPos;
+            if (InPos >= BlockStart && InPos < BlockStart + Block.Num())
+            {
+                BlockPos = static_cast<int32>(InPos - BlockStart);
+                Position = InPos;
+                return;
+            }
+
+            if (InPos < BlockStart)
+            {
+                Inner->Seek(FirstBlockOffset);
+                Position = 0;
+            }
+            else
+            {
+                Position = BlockStart + Block.Num();
+            }
+            Block.Reset();
+            BlockPos = 0;
+
+            int32 RawSize = 0;
+            int32 PackedSize = 0;
+            while (ReadBlockHeader(RawSize, PackedSize))
+            {
+                if (InPos < Position + RawSize)
+                {
+                    if (!ReadBlockData(RawSize, PackedSize))
+                    {
+                        SetError();
+                        return;
+                    }
+
+                    BlockPos = static_cast<int32>(InPos - Position);
+                    Position = InPos;
+                    return;
+                }
+
+                Inner->Seek(Inner->Tell() + PackedSize);
+                Position += RawSize;
+            }
+        }
+
+        virtual int64 Tell() override { return Position; }
+        virtual int64 TotalSize() override { return UncompressedSize; }
+        virtual FString GetArchiveName() const override { return TEXT("ALSCompressedLogReader"); }
+
+    private:
+        bool ReadBlock()
+        {
+            int32 RawSize = 0;
+            int32 PackedSize = 0;
+            return ReadBlockHeader(RawSize, PackedSize) && ReadBlockData(RawSize, PackedSize);
+        }
+
+        bool ReadBlockHeader(int32& OutRawSize, int32& OutPackedSize)
+        {
+            if (!bValidHeader || Inner->Tell() >= Inner->TotalSize()) return false;
+
+            *Inner << OutRawSize << OutPackedSize;
+
+            return !Inner->IsError() && OutRawSize > 0 && OutPackedSize > 0 && OutRawSize <= BlockSize;
+        }
+
+        bool ReadBlockData(int32 RawSize, int32 PackedSize)
+        {
+            Packed.SetNumUninitialized(PackedSize, false);
+            Inner->Serialize(Packed.GetData(), PackedSize);
+
+            Block.SetNumUninitialized(RawSize, false);
+            BlockPos = 0;
+
+            return !Inner->IsError() && FCompression::UncompressMemory(FormatName, Block.GetData(), RawSize, Packed.GetData(), PackedSize);
+        }
+
+        TUniquePtr<FArchive> Inner;
+        FName FormatName;
+        TArray<uint8> Packed;
+        TArray<uint8> Block;
+        int32 BlockPos = 0;
+        int64 Position = 0;
+        int64 UncompressedSize = 0;
+        int64 FirstBlockOffset = 0;
+        bool bValidHeader = false;
+    };
+}
+
+bool FALSLogArchive::IsArchivePath(const FString& FilePath)
+{
+    return FilePath.EndsWith(ArchiveExtension);
+}
+
+bool FALSLogArchive::CompressLogFile(const FString& SourcePath, const FString& ArchivePath, TFunctionRef<bool()> ShouldContinue)
+{
+    TUniquePtr<FArchive> Source(IFileManager::Get().CreateFileReader(*SourcePath, FILEREAD_AllowWrite));
+    if (!Source.IsValid()) return false;
+
+    TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*ArchivePath));
+    if (!Archive.IsValid()) return false;
+
+    const FName FormatName = ALSLogArchive::GetCompressionFormat();
+
+    uint32 FileMagic = ALSLogArchive::Magic;
+    uint32 FileVersion = ALSLogArchive::Version;
+    FString FormatString = FormatName.ToString();
+    int64 UncompressedSize = Source->TotalSize();
+
+    *Archive << FileMagic << FileVersion << FormatString << UncompressedSize;
+
+    TArray<uint8> Raw;
+    TArray<uint8> Packed;
+    Raw.SetNumUninitialized(ALSLogArchive::BlockSize);
+    Packed.SetNumUninitialized(FCompression::CompressMemoryBound(FormatName, ALSLogArchive::BlockSize));
+
+    int64 Remaining = UncompressedSize;
+    while (Remaining > 0)
+    {
+        int32 RawSize = static_cast<int32>(FMath::Min<int64>(Remaining, ALSLogArchive::BlockSize));
+        Source->Serialize(Raw.GetData(), RawSize);
+
+        int32 PackedSize = Packed.Num();
+        if (!ShouldContinue() || Source->IsError() || !FCompression::CompressMemory(FormatName, Packed.GetData(), PackedSize, Raw.GetData(), RawSize, COMPRESS_BiasSize))
+        {
+            Archive.Reset();
+            IFileManager::Get().Delete(*ArchivePath);
+            return false;
+        }
+
+        *Archive << RawSize << PackedSize;
+        Archive->Serialize(Packed.GetData(), PackedSize);
+
+        Remaining -= RawSize;
+    }
+
+    const bool bSuccess = Archive->Close();
+    Archive.Reset();
+
+    if (!bSuccess)
+    {
+        IFileManager::Get().Delete(*ArchivePath);
+    }
+
+    return bSuccess;
+}
+
+FArchive* FALSLogArchive::CreateReader(const FString& FilePath)
+{
+    // Archived logs keep their manifest, compressed or not
+    if (FALSLogSegments::HasSegments(FilePath))
+    {
+        return FALSLogSegments::CreateReader(FilePath);
+    }
+
+    return CreateFileReader(FilePath);
+}
+
+FArchive* FALSLogArchive::CreateFileReader(const FString& FilePath)
+{
+    FArchive* FileReader = IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_AllowWrite);
+    if (!FileReader || !IsArchivePath(FilePath))
+    {
+        return FileReader;
+    }
+
+    ALSLogArchive::FCompressedLogReader* CompressedReader = new ALSLogArchive::FCompressedLogReader(FileReader);
+    if (!CompressedReader->IsValidHeader())
+    {
+        UE_LOG(LogALS, Warning, TEXT("Not a valid ALS log archive: %s"), *FilePath);
+        delete CompressedReader;
+        return nullptr;
+    }
+
+    return CompressedReader;
+}
+
+bool FALSLogArchive::LoadToString(const FString& FilePath, FString& OutContent)
+{
+    if (!IsArchivePath(FilePath) && !FALSLogSegments::HasSegments(FilePath))
+    {
+        return FFileHelper::LoadFileToString(OutContent, *FilePath);
+    }
+
+    TUniquePtr<FArchive> Reader(CreateReader(FilePath));
+    if (!Reader.IsValid()) return false;
+
+    TArray<uint8> Content;
+    Content.SetNumUninitialized(Reader->TotalSize());
+    Reader->Serialize(Content.GetData(), Content.Num());
+
+    if (Reader->IsError()) return false;
+
+    FFileHelper::BufferToString(OutContent, Content.GetData(), Content.Num());
+    return true;
+}
+
+int64 FALSLogArchive::GetLogSize(const FString& FilePath)
+{
+    if (!FALSLogSegments::HasSegments(FilePath))
+    {
+        return GetFileSize(FilePath);
+    }
+
+    TUniquePtr<FArchive> Reader(CreateReader(FilePath));
+    return Reader.IsValid() ? Reader->TotalSize() : INDEX_NONE;
+}
+
+int64 FALSLogArchive::GetFileSize(const FString& FilePath)
+{
+    if (!IsArchivePath(FilePath))
+    {
+        return IFileManager::Get().FileSize(*FilePath);
+    }
+
+    TUniquePtr<FArchive> Reader(CreateFileReader(FilePath));
+    return Reader.IsValid() ? Reader->TotalSize() : INDEX_NONE;
+}
+
+void FALSLogArchive::EnforceQuota(const FString& ArchiveDir, int64 MaxBytes)
+{
+    if (MaxBytes <= 0) return;
+
+    // Deleting single files would leave instances with holes in their segments or a sidecar without its log
+    struct FArchivedInstance
+    {
+        TArray<FString> Paths;
+        FDateTime ModificationTime;
+        int64 Size = 0;
+    };
+
+    TMap<FString, FArchivedInstance> ArchivedInstances;
+    int64 TotalBytes = 0;
+
+    IFileManager::Get().IterateDirectoryStat(*ArchiveDir, [&](const TCHAR* Path, const FFileStatData& StatData)
+        {
+            if (!StatData.bIsDirectory)
+            {
+                FArchivedInstance& Instance = ArchivedInstances.FindOrAdd(FALSLogSegments::GetInstanceName(ArchiveDir, FPaths::GetCleanFilename(Path)));
+                Instance.Paths.Add(Path);
+                Instance.ModificationTime = FMath::Max(Instance.ModificationTime, StatData.ModificationTime);
+                Instance.Size += StatData.FileSize;
+                TotalBytes += StatData.FileSize;
+            }
+            return true;
+        });
+
+    if (TotalBytes <= MaxBytes) return;
+
+    TArray<FArchivedInstance> OldestFirst;
+    ArchivedInstances.GenerateValueArray(OldestFirst);
+    Algo::SortBy(OldestFirst, &FArchivedInstance::ModificationTime);
+
+    for (const FArchivedInstance& Instance : OldestFirst)
+    {
+        if (TotalBytes <= MaxBytes) break;
+
+        for (const FString& Path : Instance.Paths)
+        {
+            IFileManager::Get().Delete(*Path, false, false, true);
+        }
+        TotalBytes -= Instance.Size;
+    }
+}
@@ -0,0 +1,265 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_LogReader.h"
+#include "ALS_LogArchive.h"
+#include "HAL/FileManager.h"
+#include "Containers/StringConv.h"
+
+namespace ALSLogReader
+{
+    static void ConvertLine(const uint8* Data, int32 NumBytes, bool bIsUTF16, FString& OutLine)
+    {
+        if (bIsUTF16)
+        {
+            auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF16CHAR*>(Data), NumBytes / 2);
+            OutLine = FString(Converted.Length(), Converted.Get());
+        }
+        else
+        {
+            auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Data), NumBytes);
+            OutLine = FString(Converted.Length(), Converted.Get());
+        }
+
+        if (OutLine.EndsWith(TEXT("\r")))
+        {
+            OutLine.LeftChopInline(1, false);
+        }
+    }
+}
+
+FALSLogReader::FALSLogReader(const FString& InFilePath, int32 InChunkSize)
+    : FileReader(FALSLogArchive::CreateReader(InFilePath))
+    , ChunkSize(FMath::Max(InChunkSize, 1024) & ~1)
+{
+    Buffer.SetNumUninitialized(ChunkSize);
+}
+
+bool FALSLogReader::FillBuffer()
+{
+    if (!FileReader.IsValid()) return false;
+
+    const int64 Remaining = FileReader->TotalSize() - FileReader->Tell();
+    if (Remaining <= 0) return false;
+
+    const int32 BytesToRead = static_cast<int32>(FMath::Min<int64>(Remaining, ChunkSize));
+    BufferOffset = FileReader->Tell();
+    FileReader->Serialize(Buffer.GetData(), BytesToRead);
+
+    BufferPos = 0;
+    BufferEnd = BytesToRead;
+
+    if (bFirstChunk)
+    {
+        bFirstChunk = false;
+
+        if (BufferEnd >= 3 && Buffer[0] == 0xEF && Buffer[1] == 0xBB && Buffer[2] == 0xBF)
+        {
+            BufferPos = 3;
+        }
+        else if (BufferEnd >= 2 && Buffer[0] == 0xFF && Buffer[1] == 0xFE)
+        {
+            BufferPos = 2;
+            bIsUTF16 = true;
+        }
+    }
+
+    return true;
+}
+
+bool FALSLogReader::ReadLine(FString& OutLine)
+{
+    const int32 UnitSize = bIsUTF16 ? 2 : 1;
+
+    while (true)
+    {
+        if (BufferPos >= BufferEnd && !FillBuffer())
+        {
+            if (PendingLine.IsEmpty()) return false;
+
+            ALSLogReader::ConvertLine(PendingLine.GetData(), PendingLine.Num(), bIsUTF16, OutLine);
+            LineOffset = PendingLineOffset;
+            PendingLine.Reset();
+            return true;
+        }
+
+        int32 LineEnd = INDEX_NONE;
+        for (int32 i = BufferPos; i + UnitSize <= BufferEnd; i += UnitSize)
+        {
+            if (Buffer[i] == '\n' && (!bIsUTF16 || Buffer[i + 1] == 0))
+            {
+                LineEnd = i;
+                break;
+            }
+        }
+
+        if (LineEnd == INDEX_NONE)
+        {
+            if (PendingLine.IsEmpty())
+            {
+                PendingLineOffset = BufferOffset + BufferPos;
+            }
+            PendingLine.Append(Buffer.GetData() + BufferPos, BufferEnd - BufferPos);
+            BufferPos = BufferEnd;
+            continue;
+        }
+
+        if (PendingLine.IsEmpty())
+        {
+            LineOffset = BufferOffset + BufferPos;
+            ALSLogReader::ConvertLine(Buffer.GetData() + BufferPos, LineEnd - BufferPos, bIsUTF16, OutLine);
+        }
+        else
+        {
+            LineOffset = PendingLineOffset;
+            PendingLine.Append(Buffer.GetData() + BufferPos, LineEnd - BufferPos);
+            ALSLogReader::ConvertLine(PendingLine.GetData(), PendingLine.Num(), bIsUTF16, OutLine);
+            PendingLine.Reset();
+        }
+
+        BufferPos = LineEnd + UnitSize;
+        return true;
+    }
+}
+
+bool FALSLogReader::Seek(int64 Offset)
+{
+    // The first chunk tells the encoding, so it is read before jumping away from it
+    if (bFirstChunk && !FillBuffer()) return false;
+
+    PendingLine.Reset();
+
+    // Records of one frame are usually close together, the current chunk often holds the next one already
+    if (Offset >= BufferOffset && Offset < BufferOffset + BufferEnd)
+    {
+        BufferPos = static_cast<int32>(Offset - BufferOffset);
+        return true;
+    }
+
+    if (Offset < 0 || Offset >= FileReader->TotalSize()) return false;
+
+    FileReader->Seek(Offset);
+    BufferPos = 0;
+    BufferEnd = 0;
+    return !FileReader->IsError();
+}
+
+bool FALSLogReader::ParseRecord(const FString& Line, FALSLogRecord& OutRecord)
+{
+    if (Line.IsEmpty()) return false;
+
+    TArray<FString> Cols;
+    Line.ParseIntoArray(Cols, TEXT("-|ALS|-"), false);
+    if (Cols.Num() < 7) return false;
+
+    auto GetColumnValue = [&Cols](int32 ColIndex) -> FString
+        {
+            return Cols[ColIndex].TrimQuotes().TrimStartAndEnd();
+        };
+
+    const FString TimeColumn = GetColumnValue(0);
+    OutRecord.bIsMonotonic = TimeColumn.StartsWith(TEXT("T"), ESearchCase::CaseSensitive);
+    OutRecord.Timestamp = FCString::Strtoui64(*TimeColumn + (OutRecord.bIsMonotonic ? 1 : 0), nullptr, 10);
+    OutRecord.DateTime = OutRecord.bIsMonotonic ? FString() : GetColumnValue(1);
+
+    OutRecord.Frame = INDEX_NONE;
+    OutRecord.ThreadId = 0;
+    OutRecord.ThreadName.Reset();
+    OutRecord.bIsSummary = false;
+    OutRecord.Repeats = 0;
+    OutRecord.RepeatStartNs = 0;
+    OutRecord.RepeatEndNs = 0;
+
+    const FString MetaColumn = OutRecord.bIsMonotonic ? GetColumnValue(1) : FString();
+    FStringView Meta = MetaColumn;
+    while (!Meta.IsEmpty())
+    {
+        // The thread tag is always last, its name is taken whole
+        int32 TagEnd = INDEX_NONE;
+        if (Meta[0] == TEXT('t') || !Meta.FindChar(TEXT(';'), TagEnd))
+        {
+            TagEnd = Meta.Len();
+        }
+
+        const FStringView Tag = Meta.Left(TagEnd);
+        Meta.RightChopInline(TagEnd + 1);
+
+        if (Tag.IsEmpty()) continue;
+
+        if (Tag[0] == TEXT('f'))
+        {
+            OutRecord.Frame = FCString::Strtoi64(Tag.GetData() + 1, nullptr, 10);
+        }
+        else if (Tag[0] == TEXT('t'))
+        {
+            int32 NameStart = INDEX_NONE;
+            Tag.FindChar(TEXT(':'), NameStart);
+
+            OutRecord.ThreadId = FCString::Strtoui64(Tag.GetData() + 1, nullptr, 10);
+            OutRecord.ThreadName = NameStart == INDEX_NONE ? FString() : FString(Tag.RightChop(NameStart + 1));
+        }
+        else if (Tag[0] == TEXT('r'))
+        {
+            // r<Repeats>:<FirstNs>:<LastNs>
+            int32 StartIndex = INDEX_NONE;
+            int32 EndIndex = INDEX_NONE;
+            if (!Tag.FindChar(TEXT(':'), StartIndex) || !Tag.FindLastChar(TEXT(':'), EndIndex) || EndIndex == StartIndex) continue;
+
+            OutRecord.Repeats = FCString::Atoi(Tag.GetData() + 1);
+            OutRecord.RepeatStartNs = FCString::Strtoui64(Tag.GetData() + StartIndex + 1, nullptr, 10);
+            OutRecord.RepeatEndNs = FCString::Strtoui64(Tag.GetData() + EndIndex + 1, nullptr, 10);
+        }
+        else if (Tag.Equals(UALS_FileLog::SummaryMeta, ESearchCase::CaseSensitive))
+        {
+            OutRecord.bIsSummary = true;
+        }
+    }
+    OutRecord.Session = GetColumnValue(2);
+    OutRecord.Context = GetColumnValue(3);
+    OutRecord.Source = GetColumnValue(4);
+    OutRecord.Level = GetColumnValue(5);
+    OutRecord.Message = GetColumnValue(6).TrimStart().ReplaceEscapedCharWithChar().Replace(TEXT("-c|c-"), TEXT(","));
+
+    return true;
+}
+
+bool FALSLogReader::ParseAnchor(const FString& Line, FString& OutSession, FALSClockAnchor& OutAnchor)
+{
+    // Cheap rejection first, only anchor lines carry an 'A' right after the first separator
+    const int32 FirstSeparator = Line.Find(TEXT("-|ALS|-"), ESearchCase::CaseSensitive);
+    if (FirstSeparator == INDEX_NONE || !Line.IsValidIndex(FirstSeparator + 7) || Line[FirstSeparator + 7] != TEXT('A'))
+    {
+        return false;
+    }
+
+    TArray<FString> Cols;
+    Line.ParseIntoArray(Cols, TEXT("-|ALS|-"), false);
+    if (Cols.Num() < 4 || !Cols[3].Contains(TEXT("[SESSION CREATED]"))) return false;
+
+    TArray<FString> AnchorValues;
+    Cols[1].TrimStartAndEnd().RightChop(1).ParseIntoArray(AnchorValues, TEXT(":"), false);
+    if (AnchorValues.Num() < 3) return false;
+
+    OutAnchor.MonotonicNs = FCString::Strtoui64(*Cols[0].TrimStartAndEnd() + 1, nullptr, 10);
+    OutAnchor.UtcTicks = FCString::Atoi64(*AnchorValues[0]);
+    OutAnchor.LocalOffsetTicks = FCString::Atoi64(*AnchorValues[1]);
+    OutAnchor.ProcessId = static_cast<uint32>(FCString::Strtoui64(*AnchorValues[2], nullptr, 10));
+    OutSession = Cols[2].TrimQuotes().TrimStartAndEnd();
+
+    return true;
+}
+
+bool FALSLogReader::ResolveTime(const FALSLogRecord& Record, const FALSClockAnchor& Anchor, int64& OutUnixNs, FDateTime& OutLocalTime)
+{
+    if (Record.bIsMonotonic)
+    {
+        OutUnixNs = Anchor.ToUnixNs(Record.Timestamp);
+        OutLocalTime = Anchor.ToLocalTime(Record.Timestamp);
+        return true;
+    }
+
+    // Older records only have a local date string, which keeps millisecond ordering within the file
+    if (!FDateTime::Parse(Record.DateTime, OutLocalTime)) return false;
+
+    OutUnixNs = (OutLocalTime.GetTicks() - FDateTime(1970, 1, 1).GetTicks()) * 100;
+    return true;
+}
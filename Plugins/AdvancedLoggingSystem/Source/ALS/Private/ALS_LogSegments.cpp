@@ -0,0 +1,272 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_LogSegments.h"
+#include "ALS_LogArchive.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace ALSLogSegments
+{
+    // Opens one segment at a time, positions and sizes span the whole logical log. Archived segments may be compressed
+    class FSegmentedLogReader : public FArchive
+    {
+    public:
+        explicit FSegmentedLogReader(const TArray<FString>& InSegmentPaths)
+            : SegmentPaths(InSegmentPaths)
+        {
+            SetIsLoading(true);
+            SetIsPersistent(true);
+
+            for (const FString& SegmentPath : SegmentPaths)
+            {
+                SegmentSizes.Add(FMath::Max<int64>(FALSLogArchive::GetFileSize(SegmentPath), 0));
+                TotalBytes += SegmentSizes.Last();
+            }
+        }
+
+        virtual void Serialize(void* Data, int64 Num) override
+        {
+            uint8* Out = static_cast<uint8*>(Data);
+
+            while (Num > 0)
+            {
+                if ((!Current.IsValid() || Current->Tell() >= Current->TotalSize()) && !OpenNextSegment())
+                {
+                    FMemory::Memzero(Out, Num);
+                    SetError();
+                    return;
+                }
+
+                const int64 ReadSize = FMath::Min<int64>(Num, Current->TotalSize() - Current->Tell());
+                Current->Serialize(Out, ReadSize);
+
+                Out += ReadSize;
+                Num -= ReadSize;
+                Position += ReadSize;
+            }
+        }
+
+        // Opens the segment holding the position and seeks within it
+        virtual void Seek(int64 InPos) override
+        {
+            Current.Reset();
+            NextSegment = SegmentPaths.Num();
+            Position = InPos;
+
+            int64 SegmentStart = 0;
+            for (int32 i = 0; i < SegmentPaths.Num(); i++)
+            {
+                if (InPos < SegmentStart + SegmentSizes[i])
+                {
+                    Current.Reset(FALSLogArchive::CreateFileReader(SegmentPaths[i]));
+                    NextSegment = i + 1;
+                    if (!Current.IsValid())
+                    {
+                        SetError();
+                        return;
+                    }
+
+                    Current->Seek(InPos - SegmentStart);
+                    return;
+                }
+                SegmentStart += SegmentSizes[i];
+            }
+        }
+
+        virtual int64 Tell() override { return Position; }
+        virtual int64 TotalSize() override { return TotalBytes; }
+        virtual FString GetArchiveName() const override { return TEXT("ALSSegmentedLogReader"); }
+
+    private:
+        bool OpenNextSegment()
+        {
+            Current.Reset();
+
+            while (NextSegment < SegmentPaths.Num())
+            {
+                Current.Reset(FALSLogArchive::CreateFileReader(SegmentPaths[NextSegment++]));
+                if (Current.IsValid() && Current->TotalSize() > 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        TArray<FString> SegmentPaths;
+        TArray<int64> SegmentSizes;
+        TUniquePtr<FArchive> Current;
+        int32 NextSegment = 0;
+        int64 Position = 0;
+        int64 TotalBytes = 0;
+    };
+
+    static bool ParseSegmentSuffix(const FString& BaseName, FString& OutInstance)
+    {
+        int32 DotIndex = INDEX_NONE;
+        if (!BaseName.FindLastChar(TEXT('.'), DotIndex)) return false;
+
+        const FString Suffix = BaseName.RightChop(DotIndex + 1);
+        if (Suffix.Len() != 4 || !Suffix.IsNumeric()) return false;
+
+        OutInstance = BaseName.Left(DotIndex);
+        return true;
+    }
+}
+
+FString FALSLogSegments::GetManifestPath(const FString& LogFilePath)
+{
+    return FPaths::ChangeExtension(LogFilePath, ManifestExtension);
+}
+
+FString FALSLogSegments::GetSegmentPath(const FString& LogFilePath, int32 SegmentIndex)
+{
+    if (SegmentIndex <= 0)
+    {
+        return LogFilePath;
+    }
+
+    return FString::Printf(TEXT("%s.%04d.log"), *FPaths::ChangeExtension(LogFilePath, TEXT("")), SegmentIndex);
+}
+
+bool FALSLogSegments::HasSegments(const FString& LogFilePath)
+{
+    return IFileManager::Get().FileExists(*GetManifestPath(LogFilePath));
+}
+
+int32 FALSLogSegments::GetLastSegmentIndex(const FString& LogFilePath)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *GetManifestPath(LogFilePath)))
+    {
+        return 0;
+    }
+
+    int32 LastIndex = 0;
+    for (const FString& Line : Lines)
+    {
+        const FString BaseName = FPaths::GetBaseFilename(Line.TrimStartAndEnd());
+
+        FString Instance;
+        if (ALSLogSegments::ParseSegmentSuffix(BaseName, Instance))
+        {
+            LastIndex = FMath::Max(LastIndex, FCString::Atoi(*BaseName.Right(4)));
+        }
+    }
+
+    return LastIndex;
+}
+
+bool FALSLogSegments::AddSegment(const FString& LogFilePath, int32 SegmentIndex)
+{
+    const FString ManifestPath = GetManifestPath(LogFilePath);
+
+    TStringBuilder<256> Lines;
+    if (!IFileManager::Get().FileExists(*ManifestPath))
+    {
+        Lines.Append(FPaths::GetCleanFilename(LogFilePath));
+        Lines.AppendChar(TEXT('\n'));
+    }
+
+    Lines.Append(FPaths::GetCleanFilename(GetSegmentPath(LogFilePath, SegmentIndex)));
+    Lines.AppendChar(TEXT('\n'));
+
+    return FFileHelper::SaveStringToFile(Lines.ToView(), *ManifestPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+void FALSLogSegments::GetSegmentPaths(const FString& LogFilePath, TArray<FString>& OutSegmentPaths)
+{
+    OutSegmentPaths.Reset();
+
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *GetManifestPath(LogFilePath)))
+    {
+        OutSegmentPaths.Add(LogFilePath);
+        return;
+    }
+
+    const FString LogDir = FPaths::GetPath(LogFilePath);
+    for (const FString& Line : Lines)
+    {
+        const FString SegmentName = Line.TrimStartAndEnd();
+        if (SegmentName.IsEmpty()) continue;
+
+        const FString SegmentPath = LogDir / SegmentName;
+        const FString CompressedSegmentPath = FPaths::ChangeExtension(SegmentPath, FALSLogArchive::ArchiveExtension);
+
+        // Segments rotated away in between are skipped, the rest still reads as one stream
+        if (IFileManager::Get().FileExists(*SegmentPath))
+        {
+            OutSegmentPaths.AddUnique(SegmentPath);
+        }
+        else if (IFileManager::Get().FileExists(*CompressedSegmentPath))
+        {
+            OutSegmentPaths.AddUnique(CompressedSegmentPath);
+        }
+    }
+}
+
+FString FALSLogSegments::GetInstanceName(const FString& LogDir, const FString& FileName)
+{
+    const FString BaseName = FPaths::GetBaseFilename(FileName);
+
+    FString Instance;
+    if (ALSLogSegments::ParseSegmentSuffix(BaseName, Instance) && HasSegments(LogDir / Instance + TEXT(".log")))
+    {
+        return Instance;
+    }
+
+    return BaseName;
+}
+
+FArchive* FALSLogSegments::CreateReader(const FString& LogFilePath)
+{
+    TArray<FString> SegmentPaths;
+    GetSegmentPaths(LogFilePath, SegmentPaths);
+
+    return new ALSLogSegments::FSegmentedLogReader(SegmentPaths);
+}
+
+bool FALSLogSegments::MoveLog(const FString& LogFilePath, const FString& NewFilePath)
+{
+    if (!HasSegments(LogFilePath))
+    {
+        return IFileManager::Get().Move(*NewFilePath, *LogFilePath, true, true);
+    }
+
+    TArray<FString> SegmentPaths;
+    GetSegmentPaths(LogFilePath, SegmentPaths);
+
+    // Segments keep their suffix and are moved one by one, so the archived log pages the same way the live one did
+    const int32 BaseNameLen = FPaths::GetBaseFilename(LogFilePath).Len();
+    const FString NewBasePath = FPaths::ChangeExtension(NewFilePath, TEXT(""));
+
+    TArray<FString> NewSegmentPaths;
+    TStringBuilder<256> Manifest;
+
+    for (const FString& SegmentPath : SegmentPaths)
+    {
+        const FString& NewSegmentPath = NewSegmentPaths.Add_GetRef(NewBasePath + FPaths::GetCleanFilename(SegmentPath).RightChop(BaseNameLen));
+        Manifest.Append(FPaths::GetCleanFilename(NewSegmentPath));
+        Manifest.AppendChar(TEXT('\n'));
+    }
+
+    // Written first: a move that fails halfway leaves both manifests listing the segments, and readers skip the ones that are gone
+    if (!FFileHelper::SaveStringToFile(Manifest.ToView(), *GetManifestPath(NewFilePath), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        return false;
+    }
+
+    for (int32 i = 0; i < SegmentPaths.Num(); i++)
+    {
+        if (!IFileManager::Get().Move(*NewSegmentPaths[i], *SegmentPaths[i], true, true))
+        {
+            return false;
+        }
+    }
+
+    IFileManager::Get().Delete(*GetManifestPath(LogFilePath));
+    return true;
+}
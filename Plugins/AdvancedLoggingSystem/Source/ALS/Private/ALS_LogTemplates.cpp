@@ -0,0 +1,300 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_LogTemplates.h"
+#include "ALS_NumberFormat.h"
+#include "ALS_Trace.h"
+#include "Async/ParallelFor.h"
+
+namespace ALSLogTemplates
+{
+    // Leading tokens used to pick a branch, how many children a branch may have before the rest share a wildcard child,
+    // and the share of equal tokens a template needs to absorb a message
+    static constexpr int32 TreeDepth = 2;
+    static constexpr int32 MaxChildren = 100;
+    static constexpr double SimilarityThreshold = 0.5;
+    static constexpr int32 EntriesPerChunk = 4096;
+
+    struct FTemplate
+    {
+        TArray<FString> Tokens;
+        TArray<double> MinValues;
+        TArray<double> MaxValues;
+        FLogEntries Entry;
+    };
+
+    struct FNode
+    {
+        TMap<FString, TUniquePtr<FNode>> Children;
+        TArray<int32> TemplateIndices;
+    };
+
+    static bool IsHexDigit(TCHAR Char)
+    {
+        return FChar::IsDigit(Char) || (Char >= TEXT('a') && Char <= TEXT('f')) || (Char >= TEXT('A') && Char <= TEXT('F'));
+    }
+
+    // 32 hex digits, or 8-4-4-4-12 with dashes
+    static bool IsGuid(const FString& Token)
+    {
+        const int32 Len = Token.Len();
+        if (Len != 32 && Len != 36) return false;
+
+        for (int32 i = 0; i < Len; ++i)
+        {
+            const bool bDash = Len == 36 && (i == 8 || i == 13 || i == 18 || i == 23);
+            if (bDash ? Token[i] != TEXT('-') : !IsHexDigit(Token[i])) return false;
+        }
+
+        return true;
+    }
+
+    class FDrainTree
+    {
+    public:
+        TArray<FTemplate> Templates;
+
+        void Add(TArray<FString>&& Tokens, TArray<double>&& MinValues, TArray<double>&& MaxValues, const FLogEntries& Entry)
+        {
+            // Templates never span call sites, the same as the batch view's Source|Message key
+            TUniquePtr<FNode>& Root = Roots.FindOrAdd(FString::Printf(TEXT("%s|%s|%s|%d"), *Entry.Context, *Entry.Source, *Entry.Level, Tokens.Num()));
+            if (!Root.IsValid())
+            {
+                Root = MakeUnique<FNode>();
+            }
+
+            FNode* Node = Root.Get();
+            for (int32 Depth = 0; Depth < FMath::Min(TreeDepth, Tokens.Num()); ++Depth)
+            {
+                const FString& Key = Tokens[Depth].Contains(FALSLogTemplates::Wildcard) ? FString(FALSLogTemplates::Wildcard) : Tokens[Depth];
+
+                TUniquePtr<FNode>* Child = Node->Children.Find(Key);
+                if (!Child)
+                {
+                    const FString ChildKey = Node->Children.Num() < MaxChildren ? Key : FString(FALSLogTemplates::Wildcard);
+                    Child = &Node->Children.FindOrAdd(ChildKey);
+                    if (!Child->IsValid())
+                    {
+                        *Child = MakeUnique<FNode>();
+                    }
+                }
+
+                Node = Child->Get();
+            }
+
+            int32 BestIndex = INDEX_NONE;
+            double BestSimilarity = -1.0;
+            for (const int32 TemplateIndex : Node->TemplateIndices)
+            {
+                const double Similarity = GetSimilarity(Templates[TemplateIndex].Tokens, Tokens);
+                if (Similarity > BestSimilarity)
+                {
+                    BestSimilarity = Similarity;
+                    BestIndex = TemplateIndex;
+                }
+            }
+
+            if (BestIndex == INDEX_NONE || BestSimilarity < SimilarityThreshold)
+            {
+                Node->TemplateIndices.Add(Templates.Num());
+
+                FTemplate& Template = Templates.AddDefaulted_GetRef();
+                Template.Tokens = MoveTemp(Tokens);
+                Template.MinValues = MoveTemp(MinValues);
+                Template.MaxValues = MoveTemp(MaxValues);
+                Template.Entry = Entry;
+                return;
+            }
+
+            Merge(Templates[BestIndex], Tokens, MinValues, MaxValues, Entry);
+        }
+
+    private:
+        TMap<FString, TUniquePtr<FNode>> Roots;
+
+        static double GetSimilarity(const TArray<FString>& TemplateTokens, const TArray<FString>& Tokens)
+        {
+            int32 Equal = 0;
+            for (int32 i = 0; i < Tokens.Num(); ++i)
+            {
+                Equal += TemplateTokens[i] == Tokens[i] ? 1 : 0;
+            }
+
+            return Tokens.Num() > 0 ? static_cast<double>(Equal) / Tokens.Num() : 1.0;
+        }
+
+        static void Merge(FTemplate& Template, const TArray<FString>& Tokens, const TArray<double>& MinValues, const TArray<double>& MaxValues, const FLogEntries& Entry)
+        {
+            for (int32 i = 0; i < Tokens.Num(); ++i)
+            {
+                if (!Template.Tokens[i].Equals(Tokens[i], ESearchCase::CaseSensitive))
+                {
+                    Template.Tokens[i] = FALSLogTemplates::Wildcard;
+                }
+
+                // NaN on either side keeps the other, a position that was never numeric stays NaN
+                Template.MinValues[i] = FMath::IsNaN(Template.MinValues[i]) ? MinValues[i] : (FMath::IsNaN(MinValues[i]) ? Template.MinValues[i] : FMath::Min(Template.MinValues[i], MinValues[i]));
+                Template.MaxValues[i] = FMath::IsNaN(Template.MaxValues[i]) ? MaxValues[i] : (FMath::IsNaN(MaxValues[i]) ? Template.MaxValues[i] : FMath::Max(Template.MaxValues[i], MaxValues[i]));
+            }
+
+            FLogEntries& Merged = Template.Entry;
+            Merged.Count += Entry.Count;
+            Merged.StartTime = FMath::Min(Merged.StartTime, Entry.StartTime);
+            Merged.EndTime = FMath::Max(Merged.EndTime, Entry.EndTime);
+            Merged.Frame = Entry.Timestamp < Merged.Timestamp ? Entry.Frame : Merged.Frame;
+            Merged.Timestamp = FMath::Min<int64>(Merged.Timestamp, Entry.Timestamp);
+        }
+    };
+
+    static void AddEntry(FDrainTree& Tree, const FLogEntries& Entry)
+    {
+        TArray<FString> Words;
+        Entry.Message.ParseIntoArrayWS(Words);
+
+        TArray<FString> Tokens;
+        TArray<double> Values;
+        Tokens.Reserve(Words.Num());
+        Values.Reserve(Words.Num());
+
+        for (const FString& Word : Words)
+        {
+            FString Masked;
+            double Value;
+            FALSLogTemplates::MaskToken(Word, Masked, Value);
+            Tokens.Add(MoveTemp(Masked));
+            Values.Add(Value);
+        }
+
+        TArray<double> MaxValues = Values;
+        Tree.Add(MoveTemp(Tokens), MoveTemp(Values), MoveTemp(MaxValues), Entry);
+    }
+
+    static FLogEntries ToEntry(FTemplate& Template)
+    {
+        FLogEntries Entry = MoveTemp(Template.Entry);
+        Entry.Message = FString::Join(Template.Tokens, TEXT(" "));
+
+        TStringBuilder<128> Range;
+        int32 Position = 0;
+        for (int32 i = 0; i < Template.Tokens.Num(); ++i)
+        {
+            if (!Template.Tokens[i].Contains(FALSLogTemplates::Wildcard)) continue;
+
+            Position++;
+            if (FMath::IsNaN(Template.MinValues[i])) continue;
+
+            Range.Append(Range.Len() > 0 ? TEXT(", #") : TEXT("#"));
+            FALSNumberFormat::AppendInt(Range, Position);
+            Range.Append(TEXT(": "));
+            Range.Appendf(TEXT("%g"), Template.MinValues[i]);
+            if (Template.MaxValues[i] != Template.MinValues[i])
+            {
+                Range.Append(TEXT(" .. "));
+                Range.Appendf(TEXT("%g"), Template.MaxValues[i]);
+            }
+        }
+
+        Entry.ValueRange = Range.ToString();
+        return Entry;
+    }
+}
+
+bool FALSLogTemplates::MaskToken(const FString& Token, FString& OutMasked, double& OutValue)
+{
+    OutValue = NAN;
+
+    if (ALSLogTemplates::IsGuid(Token))
+    {
+        OutMasked = Wildcard;
+        return true;
+    }
+
+    TStringBuilder<64> Masked;
+    bool bMasked = false;
+
+    const int32 Len = Token.Len();
+    int32 i = 0;
+    while (i < Len)
+    {
+        const TCHAR Char = Token[i];
+
+        // 0x followed by hex digits
+        if (Char == TEXT('0') && i + 2 < Len && (Token[i + 1] == TEXT('x') || Token[i + 1] == TEXT('X')) && ALSLogTemplates::IsHexDigit(Token[i + 2]))
+        {
+            i += 2;
+            while (i < Len && ALSLogTemplates::IsHexDigit(Token[i])) ++i;
+
+            Masked.Append(Wildcard);
+            bMasked = true;
+            continue;
+        }
+
+        // A sign only belongs to the number when it does not follow a letter or digit, "-5" but not "A-5"
+        const bool bSign = (Char == TEXT('-') || Char == TEXT('+')) && i + 1 < Len && FChar::IsDigit(Token[i + 1]) && (i == 0 || !FChar::IsAlnum(Token[i - 1]));
+        if (FChar::IsDigit(Char) || bSign)
+        {
+            const int32 Start = i;
+            i += bSign ? 1 : 0;
+            while (i < Len && FChar::IsDigit(Token[i])) ++i;
+            if (i + 1 < Len && Token[i] == TEXT('.') && FChar::IsDigit(Token[i + 1]))
+            {
+                ++i;
+                while (i < Len && FChar::IsDigit(Token[i])) ++i;
+            }
+
+            if (FMath::IsNaN(OutValue))
+            {
+                OutValue = FCString::Atod(*Token.Mid(Start, i - Start));
+            }
+
+            Masked.Append(Wildcard);
+            bMasked = true;
+            continue;
+        }
+
+        Masked.AppendChar(Char);
+        ++i;
+    }
+
+    OutMasked = bMasked ? FString(Masked.ToView()) : Token;
+    return bMasked;
+}
+
+TArray<FLogEntries> FALSLogTemplates::Mine(const TArray<FLogEntries>& Entries)
+{
+    ALS_TRACE_SCOPE(MineTemplates);
+
+    // Each chunk builds its own tree, the chunk templates are then merged into one tree the same way single messages are
+    const int32 NumChunks = FMath::Max(1, FMath::DivideAndRoundUp(Entries.Num(), ALSLogTemplates::EntriesPerChunk));
+    TArray<ALSLogTemplates::FDrainTree> ChunkTrees;
+    ChunkTrees.SetNum(NumChunks);
+
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
+        {
+            const int32 Start = ChunkIndex * ALSLogTemplates::EntriesPerChunk;
+            const int32 End = FMath::Min(Start + ALSLogTemplates::EntriesPerChunk, Entries.Num());
+
+            for (int32 i = Start; i < End; ++i)
+            {
+                ALSLogTemplates::AddEntry(ChunkTrees[ChunkIndex], Entries[i]);
+            }
+        });
+
+    ALSLogTemplates::FDrainTree Tree;
+    for (ALSLogTemplates::FDrainTree& ChunkTree : ChunkTrees)
+    {
+        for (ALSLogTemplates::FTemplate& Template : ChunkTree.Templates)
+        {
+            Tree.Add(MoveTemp(Template.Tokens), MoveTemp(Template.MinValues), MoveTemp(Template.MaxValues), Template.Entry);
+        }
+    }
+
+    TArray<FLogEntries> Result;
+    Result.Reserve(Tree.Templates.Num());
+
+    for (ALSLogTemplates::FTemplate& Template : Tree.Templates)
+    {
+        Result.Add(ALSLogTemplates::ToEntry(Template));
+    }
+
+    return Result;
+}
@@ -5,6 +5,14 @@
 #include "ALS_Settings.h"
 #include "ALS_EntryObjects.h"
 #include "ALS_FileLog.h"
+#include "ALS_LogReader.h"
+#include "ALS_LogArchive.h"
+#include "ALS_LogSegments.h"
+#include "ALS_Timers.h"
+#include "ALS_Metrics.h"
+#include "ALS_LogTemplates.h"
+#include "ALS_CallSiteStats.h"
+#include "ALS_Trace.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Async/ParallelFor.h"
@@ -19,6 +27,190 @@
 #include "Settings/LevelEditorPlaySettings.h"
 #endif
 
+namespace ALSLogsUMG
+{
+    // Streams every segment of the logical log in write order and visits the session's records with its clock anchor.
+    // The anchor is written at the top of each segment, so it is known before the first record it applies to
+    template <typename FunctionType>
+    static bool ForEachSessionRecord(const FString& LogFilePath, const FString& SessionID, FunctionType&& Visit)
+    {
+        FALSLogReader Reader(LogFilePath);
+        if (!Reader.IsValid()) return false;
+
+        FALSClockAnchor SessionAnchor = UALS_FileLog::GetClockAnchor();
+        FString Line;
+        FALSLogRecord Record;
+
+        while (Reader.ReadLine(Line))
+        {
+            FString AnchorSession;
+            FALSClockAnchor Anchor;
+            if (FALSLogReader::ParseAnchor(Line, AnchorSession, Anchor))
+            {
+                if (AnchorSession == SessionID)
+                {
+                    SessionAnchor = Anchor;
+                }
+                continue;
+            }
+
+            if (FALSLogReader::ParseRecord(Line, Record) && Record.Session == SessionID)
+            {
+                Visit(Reader.GetLineOffset(), Record, SessionAnchor);
+            }
+        }
+
+        return true;
+    }
+
+    static void SetPeriodMessage(FLogEntries& Entry)
+    {
+        TStringBuilder<96> Period;
+        Period.Appendf(TEXT("(%d times logged from "), Entry.Count);
+        FALSTimeFormat::AppendTimeOfDay(Entry.StartTime, false, Period);
+        Period.Append(TEXT(" to "));
+        FALSTimeFormat::AppendTimeOfDay(Entry.EndTime, false, Period);
+        Period.Append(TEXT(")"));
+        Entry.PeriodMessage = Period.ToString();
+    }
+
+    // The trailer of a collapsed run stands for every repeat it replaced
+    static void ApplyRepeats(const FALSLogRecord& Record, const FALSClockAnchor& Anchor, FLogEntries& Entry)
+    {
+        if (Record.Repeats <= 0) return;
+
+        Entry.Count = Record.Repeats;
+        Entry.StartTime = Anchor.ToLocalTime(Record.RepeatStartNs);
+        Entry.EndTime = Anchor.ToLocalTime(Record.RepeatEndNs);
+        SetPeriodMessage(Entry);
+    }
+
+    // A run the writer is still collapsing, read as the trailer it will be written as
+    static FALSLogRecord ToRecord(const FALSRepeatRun& Run, const FString& SessionID)
+    {
+        FALSLogRecord Record;
+        Record.bIsMonotonic = true;
+        Record.Timestamp = Run.LastNs;
+        Record.Frame = Run.LastFrame;
+        Record.ThreadId = Run.ThreadId;
+        Record.Repeats = Run.Repeats;
+        Record.RepeatStartNs = Run.FirstNs;
+        Record.RepeatEndNs = Run.LastNs;
+        Record.Session = SessionID;
+        Record.Context = Run.CallerName;
+        Record.Source = Run.SourceID;
+        Record.Level = Run.Level;
+        Record.Message = Run.Message;
+        return Record;
+    }
+}
+
+// Frame tagged records of one session, read from every segment of its instance. Records of other threads and instances can sit between those of a frame
+struct FALSFrameIndex
+{
+    FString Instance;
+    FString SessionID;
+    FString LogFilePath;
+    FALSClockAnchor Anchor;
+    TArray<FFrameEntries> Frames;
+
+    // Where each record of a frame starts in the logical log, read back through FALSLogReader::Seek
+    TMap<int64, TArray<int64>> FrameOffsets;
+
+    // Streams the whole log, call it off the game thread
+    static TSharedPtr<FALSFrameIndex> Build(const FString& Instance, const FString& SessionID, const FString& LogFilePath, FString& OutMessage);
+
+    bool ReadFrame(int64 Frame, TArray<FLogEntries>& OutEntries) const;
+};
+
+TSharedPtr<FALSFrameIndex> FALSFrameIndex::Build(const FString& Instance, const FString& SessionID, const FString& LogFilePath, FString& OutMessage)
+{
+    ALS_TRACE_SCOPE(BuildFrameIndex);
+
+    TSharedPtr<FALSFrameIndex> NewIndex = MakeShared<FALSFrameIndex>();
+    NewIndex->Instance = Instance;
+    NewIndex->SessionID = SessionID;
+    NewIndex->LogFilePath = LogFilePath;
+    NewIndex->Anchor = UALS_FileLog::GetClockAnchor();
+
+    TMap<int64, int32> FrameEntryIndex;
+    const bool bRead = ALSLogsUMG::ForEachSessionRecord(LogFilePath, SessionID, [&](int64 LineOffset, const FALSLogRecord& Record, const FALSClockAnchor& SessionAnchor)
+        {
+            if (Record.Frame == INDEX_NONE) return;
+
+            NewIndex->Anchor = SessionAnchor;
+
+            int32& EntryIndex = FrameEntryIndex.FindOrAdd(Record.Frame, INDEX_NONE);
+            if (EntryIndex == INDEX_NONE)
+            {
+                EntryIndex = NewIndex->Frames.AddDefaulted();
+                NewIndex->Frames[EntryIndex].Frame = Record.Frame;
+
+                int64 UnixNs;
+                FDateTime LocalTime;
+                if (FALSLogReader::ResolveTime(Record, SessionAnchor, UnixNs, LocalTime))
+                {
+                    NewIndex->Frames[EntryIndex].DateTime = FALSTimeFormat::FormatDateTime(LocalTime);
+                }
+            }
+
+            NewIndex->FrameOffsets.FindOrAdd(Record.Frame).Add(LineOffset);
+
+            // A repeat trailer stands for itself and every repeat it replaced
+            const int32 NumRecords = Record.Repeats + 1;
+
+            FFrameEntries& Entry = NewIndex->Frames[EntryIndex];
+            Entry.NumRecords += NumRecords;
+            Entry.NumWarnings += Record.Level == TEXT("Warning") ? NumRecords : 0;
+            Entry.NumErrors += Record.Level == TEXT("Error") ? NumRecords : 0;
+        });
+
+    if (!bRead)
+    {
+        OutMessage = TEXT("Error: Unable to parse or access the log file.");
+        return nullptr;
+    }
+
+    if (NewIndex->Frames.IsEmpty())
+    {
+        OutMessage = FString::Printf(TEXT("No frame tagged records found for session %s"), *SessionID);
+        return nullptr;
+    }
+
+    Algo::SortBy(NewIndex->Frames, &FFrameEntries::Frame);
+    return NewIndex;
+}
+
+bool FALSFrameIndex::ReadFrame(int64 Frame, TArray<FLogEntries>& OutEntries) const
+{
+    const TArray<int64>* Offsets = FrameOffsets.Find(Frame);
+    if (!Offsets) return false;
+
+    FALSLogReader Reader(LogFilePath);
+    if (!Reader.IsValid()) return false;
+
+    FString Line;
+    for (const int64 Offset : *Offsets)
+    {
+        if (!Reader.Seek(Offset) || !Reader.ReadLine(Line)) continue;
+
+        FALSLogRecord Record;
+        if (!FALSLogReader::ParseRecord(Line, Record)) continue;
+
+        int64 UnixNs;
+        FDateTime LocalTime;
+        if (!FALSLogReader::ResolveTime(Record, Anchor, UnixNs, LocalTime)) continue;
+
+        FLogEntries& Entry = OutEntries.Add_GetRef(FLogEntries(Record.Level, Record.Message, Record.Source, LocalTime, UnixNs));
+        Entry.Context = Record.Context;
+        Entry.Instance = Instance;
+        Entry.Frame = Frame;
+        ALSLogsUMG::ApplyRepeats(Record, Anchor, Entry);
+    }
+
+    return true;
+}
+
 struct FALSKey
 {
     FString Composite;
@@ -130,8 +322,8 @@ FString UALS_LogsUMG::GetLatestInstance() const
         }
     }
 
-    LatestFile.RemoveFromEnd(TEXT(".log"));
-    return LatestFile;
+    // The newest file of a long running instance is its last segment
+    return LatestFile.IsEmpty() ? LatestFile : FALSLogSegments::GetInstanceName(LogDir, LatestFile);
 }
 
 FString UALS_LogsUMG::GetCurrentInstance() const
@@ -144,15 +336,33 @@ bool UALS_LogsUMG::GetAllInstances(TArray<FString>& OutInstances, FString& OutMe
     FString LogDir = UALS_Settings::Get()->FileLogRootDir.Path;
     IFileManager::Get().FindFiles(OutInstances, *LogDir, TEXT(".log"));
 
+    // Segments are listed through their base instance only
+    OutInstances.RemoveAll([&LogDir](const FString& FileName)
+        {
+            return FALSLogSegments::GetInstanceName(LogDir, FileName) != FPaths::GetBaseFilename(FileName);
+        });
+
     if (UALS_Settings::Get()->bIncludeArchivedLogsInViewer)
     {
         FString OldLogsDir = LogDir / TEXT("ArchivedLogs");
-        IFileManager::Get().FindFiles(OutInstances, *OldLogsDir, TEXT(".log"));
+
+        TArray<FString> ArchivedFiles;
+        IFileManager::Get().FindFiles(ArchivedFiles, *OldLogsDir, TEXT(".log"));
+        IFileManager::Get().FindFiles(ArchivedFiles, *OldLogsDir, FALSLogArchive::ArchiveExtension);
+
+        // Archived logs keep their segments and manifest
+        ArchivedFiles.RemoveAll([&OldLogsDir](const FString& FileName)
+            {
+                return FALSLogSegments::GetInstanceName(OldLogsDir, FileName) != FPaths::GetBaseFilename(FileName);
+            });
+
+        OutInstances.Append(ArchivedFiles);
     }
 
     for (FString& FileName : OutInstances)
     {
         FileName.RemoveFromEnd(TEXT(".log"));
+        FileName.RemoveFromEnd(FALSLogArchive::ArchiveExtension);
     }
 
     if (OutInstances.IsEmpty())
@@ -166,37 +376,33 @@ bool UALS_LogsUMG::GetAllInstances(TArray<FString>& OutInstances, FString& OutMe
 
 bool UALS_LogsUMG::GetFileContent(const FString Instance, FString& OutContent, FString& OutMessage, bool IgnoreSizeCheck)
 {
-    FString LogFilePath = UALS_Settings::Get()->FileLogRootDir.Path / Instance + TEXT(".log");
-    FString OldFilePath = UALS_Settings::Get()->FileLogRootDir.Path / TEXT("ArchivedLogs") / Instance + TEXT(".log");
+    // Records still queued for the background writer would otherwise be missing from the view
+    UALS_FileLog::FlushLogFiles();
 
-    if (FPaths::FileExists(LogFilePath))
+    FString LogFilePath = GetInstanceFilePath(Instance);
+
+    if (LogFilePath.IsEmpty())
     {
-        if (!FFileHelper::LoadFileToString(OutContent, *LogFilePath))
-        {
-            OutMessage = "Error: Unable to parse or access the log file.";
-            return false;
-        }
+        OutMessage = "Error: Unable to find the Instance file. Please check if the file is present or has proper read permissions.";
+        return false;
     }
-    else if (UALS_Settings::Get()->bIncludeArchivedLogsInViewer && FPaths::FileExists(OldFilePath))
-    {
-        if (!FFileHelper::LoadFileToString(OutContent, *OldFilePath))
-        {
-            OutMessage = "Error: Unable to parse or access the archived log file.";
-            return false;
-        }
 
-        LogFilePath = OldFilePath;
-    }
-    else
+    // A rolled over log is loaded one segment at a time, so memory and the size check are bounded by the segment size
+    TArray<FString> SegmentPaths;
+    FALSLogSegments::GetSegmentPaths(LogFilePath, SegmentPaths);
+
+    if (SegmentPaths.IsEmpty())
     {
-        OutMessage = "Error: Unable to find the Instance file. Please check if the file is present or has proper read permissions.";
+        OutMessage = "Error: Unable to parse or access the log file.";
         return false;
     }
 
+    const FString& SegmentPath = SegmentPaths[ViewedSegment == INDEX_NONE ? SegmentPaths.Num() - 1 : FMath::Clamp(ViewedSegment, 0, SegmentPaths.Num() - 1)];
+
     if (!IgnoreSizeCheck)
     {
         int32 GetFileSize;
-        bool IsLarger = UALS_FileLog::IsFileBigger(LogFilePath, GetFileSize);
+        bool IsLarger = UALS_FileLog::IsFileBigger(SegmentPath, GetFileSize);
 
         if (IsLarger)
         {
@@ -209,11 +415,62 @@ bool UALS_LogsUMG::GetFileContent(const FString Instance, FString& OutContent, F
         }
     }
 
+    // Compressed archives are decompressed on the fly
+    if (!FALSLogArchive::LoadToString(SegmentPath, OutContent))
+    {
+        OutMessage = "Error: Unable to parse or access the log file.";
+        return false;
+    }
+
     return true;
 }
 
+int32 UALS_LogsUMG::GetNumSegments(const FString& Instance) const
+{
+    const FString LogFilePath = GetInstanceFilePath(Instance);
+    if (LogFilePath.IsEmpty()) return 0;
+
+    TArray<FString> SegmentPaths;
+    FALSLogSegments::GetSegmentPaths(LogFilePath, SegmentPaths);
+    return SegmentPaths.Num();
+}
+
+void UALS_LogsUMG::SetViewedSegment(int32 SegmentIndex)
+{
+    ViewedSegment = SegmentIndex;
+}
+
+FString UALS_LogsUMG::GetInstanceFilePath(const FString& Instance) const
+{
+    FString LogFilePath = UALS_Settings::Get()->FileLogRootDir.Path / Instance + TEXT(".log");
+    FString OldFilePath = UALS_Settings::Get()->FileLogRootDir.Path / TEXT("ArchivedLogs") / Instance + TEXT(".log");
+
+    if (FPaths::FileExists(LogFilePath))
+    {
+        return LogFilePath;
+    }
+
+    if (UALS_Settings::Get()->bIncludeArchivedLogsInViewer)
+    {
+        if (FPaths::FileExists(OldFilePath))
+        {
+            return OldFilePath;
+        }
+
+        const FString CompressedFilePath = FPaths::ChangeExtension(OldFilePath, FALSLogArchive::ArchiveExtension);
+        if (FPaths::FileExists(CompressedFilePath))
+        {
+            return CompressedFilePath;
+        }
+    }
+
+    return TEXT("");
+}
+
 bool UALS_LogsUMG::GetAllSessions(const bool IgnoreSizeCheck, const FString& Instance, TArray<FString>& OutSessions, FString& OutMessage)
 {
+    ALS_TRACE_SCOPE(GetAllSessions);
+
     FString FileContent;
     if (!GetFileContent(Instance, FileContent, OutMessage, IgnoreSizeCheck))
     {
@@ -251,6 +508,8 @@ bool UALS_LogsUMG::GetAllSessions(const bool IgnoreSizeCheck, const FString& Ins
 
 bool UALS_LogsUMG::GetAllContexts(const FString& Instance, const FString& SessionID, TArray<FContextEntries>& OutContexts, FString& OutMessage)
 {
+    ALS_TRACE_SCOPE(GetAllContexts);
+
     FString FileContent;
     if (!GetFileContent(Instance, FileContent, OutMessage))
     {
@@ -316,6 +575,287 @@ bool UALS_LogsUMG::GetAllContexts(const FString& Instance, const FString& Sessio
     return true;
 }
 
+bool UALS_LogsUMG::GetTimerSummaries(const FString& Instance, const FString& SessionID, TArray<FTimerSummaryEntries>& OutSummaries, FString& OutMessage)
+{
+    ALS_TRACE_SCOPE(GetTimerSummaries);
+
+    // Summaries of the whole session, not only of the segment the message view is paging through
+    UALS_FileLog::FlushLogFiles();
+
+    const FString LogFilePath = GetInstanceFilePath(Instance);
+    if (LogFilePath.IsEmpty() || !ALSLogsUMG::ForEachSessionRecord(LogFilePath, SessionID, [&OutSummaries](int64 LineOffset, const FALSLogRecord& Record, const FALSClockAnchor& SessionAnchor)
+        {
+            if (!Record.bIsSummary || Record.Context == FALSMetrics::SummaryCaller) return;
+
+            FTimerSummaryEntries Summary;
+            if (!FALSTimers::ParseSummary(Record.Message, Summary)) return;
+
+            int64 UnixNs;
+            FDateTime LocalTime;
+            if (!FALSLogReader::ResolveTime(Record, SessionAnchor, UnixNs, LocalTime)) return;
+
+            Summary.Source = Record.Source;
+            Summary.DateTime = FALSTimeFormat::FormatDateTime(LocalTime);
+            Summary.Timestamp = UnixNs;
+            OutSummaries.Add(MoveTemp(Summary));
+        }))
+    {
+        OutMessage = TEXT("Error: Unable to parse or access the log file.");
+        return false;
+    }
+
+    Algo::Sort(OutSummaries, [](const FTimerSummaryEntries& A, const FTimerSummaryEntries& B)
+        {
+            if (A.Name != B.Name) return A.Name < B.Name;
+            if (A.Source != B.Source) return A.Source < B.Source;
+            return A.Timestamp < B.Timestamp;
+        });
+
+    if (OutSummaries.IsEmpty())
+    {
+        OutMessage = FString::Printf(TEXT("No timer summaries found for session %s. Add ALS_SCOPE_TIMER to the code to measure"), *SessionID);
+        return false;
+    }
+
+    return true;
+}
+
+bool UALS_LogsUMG::GetTopTalkers(const FString& Instance, const FString& SessionID, int32 NumTop, TArray<FCallSiteEntries>& OutTalkers, FString& OutMessage)
+{
+    ALS_TRACE_SCOPE(GetTopTalkers);
+
+    OutTalkers.Reset();
+
+    const FString LogFilePath = GetInstanceFilePath(Instance);
+    if (LogFilePath.IsEmpty())
+    {
+        OutMessage = TEXT("Error: Unable to find the Instance file. Please check if the file is present or has proper read permissions.");
+        return false;
+    }
+
+    TArray<FALSCallSiteSample> Samples;
+    FALSCallSiteStats::LoadSidecar(LogFilePath, SessionID, Samples);
+
+    // Totals not yet persisted belong to the running session
+    if (SessionID == UALS_FileLog::GetCurrentSessionID())
+    {
+        TArray<FALSCallSiteSample> LiveSamples;
+        FALSCallSiteStats::GetCallSites(&LogFilePath, LiveSamples);
+        FALSCallSiteStats::MergeSamples(LiveSamples, Samples);
+    }
+
+    if (Samples.IsEmpty())
+    {
+        OutMessage = FString::Printf(TEXT("No call site statistics found for session %s. They are kept for sessions written since call site statistics were added"), *SessionID);
+        return false;
+    }
+
+    const int64 LocalOffsetTicks = UALS_FileLog::GetClockAnchor().LocalOffsetTicks;
+    const int64 EpochTicks = FDateTime(1970, 1, 1).GetTicks();
+
+    for (int32 i = 0; i < FMath::Min(NumTop, Samples.Num()); ++i)
+    {
+        const FALSCallSiteSample& Sample = Samples[i];
+
+        FCallSiteEntries& Entry = OutTalkers.AddDefaulted_GetRef();
+        Entry.Source = Sample.SourceID;
+        Entry.Messages = static_cast<int64>(Sample.Messages);
+        Entry.Bytes = static_cast<int64>(Sample.Bytes);
+        Entry.Suppressed = static_cast<int64>(Sample.Suppressed);
+        Entry.LastSeen = FALSTimeFormat::FormatDateTime(FDateTime(EpochTicks + Sample.LastSeenUnixNs / 100 + LocalOffsetTicks));
+    }
+
+    return true;
+}
+
+bool UALS_LogsUMG::GetMetricSeries(const FString& Instance, const FString& SessionID, TArray<FMetricSeriesEntries>& OutSeries, FString& OutMessage)
+{
+    ALS_TRACE_SCOPE(GetMetricSeries);
+
+    // The series span the whole session, not only the segment the message view is paging through
+    UALS_FileLog::FlushLogFiles();
+
+    TMap<FString, int32> SeriesIndex;
+    int64 FirstUnixNs = INDEX_NONE;
+
+    const FString LogFilePath = GetInstanceFilePath(Instance);
+    if (LogFilePath.IsEmpty() || !ALSLogsUMG::ForEachSessionRecord(LogFilePath, SessionID, [&](int64 LineOffset, const FALSLogRecord& Record, const FALSClockAnchor& SessionAnchor)
+        {
+            if (!Record.bIsSummary || Record.Context != FALSMetrics::SummaryCaller) return;
+
+            TArray<FALSMetricSample> Samples;
+            if (!FALSMetrics::ParseSummary(Record.Message, Samples)) return;
+
+            int64 UnixNs;
+            FDateTime LocalTime;
+            if (!FALSLogReader::ResolveTime(Record, SessionAnchor, UnixNs, LocalTime)) return;
+
+            if (FirstUnixNs == INDEX_NONE)
+            {
+                FirstUnixNs = UnixNs;
+            }
+
+            const double Seconds = static_cast<double>(UnixNs - FirstUnixNs) / 1e9;
+
+            for (const FALSMetricSample& Sample : Samples)
+            {
+                int32& Index = SeriesIndex.FindOrAdd(Sample.Name, INDEX_NONE);
+                if (Index == INDEX_NONE)
+                {
+                    Index = OutSeries.AddDefaulted();
+                    OutSeries[Index].Name = Sample.Name;
+                    OutSeries[Index].Type = Sample.Type == EALSMetricType::Gauge ? TEXT("Gauge") : TEXT("Counter");
+                    OutSeries[Index].MinValue = Sample.Value;
+                    OutSeries[Index].MaxValue = Sample.Value;
+                }
+
+                FMetricSeriesEntries& Series = OutSeries[Index];
+                Series.Seconds.Add(Seconds);
+                Series.Values.Add(Sample.Value);
+                Series.MinValue = FMath::Min(Series.MinValue, Sample.Value);
+                Series.MaxValue = FMath::Max(Series.MaxValue, Sample.Value);
+                Series.Total = Sample.Type == EALSMetricType::Gauge ? Sample.Value : Series.Total + Sample.Value;
+            }
+        }))
+    {
+        OutMessage = TEXT("Error: Unable to parse or access the log file.");
+        return false;
+    }
+
+    Algo::SortBy(OutSeries, &FMetricSeriesEntries::Name);
+
+    if (OutSeries.IsEmpty())
+    {
+        OutMessage = FString::Printf(TEXT("No metrics found for session %s. Add ALS_COUNTER_ADD or ALS_GAUGE_SET to the code to record"), *SessionID);
+        return false;
+    }
+
+    return true;
+}
+
+void UALS_LogsUMG::BuildFrameIndex(const FString& Instance, const FString& SessionID, TFunction<void(TSharedPtr<FALSFrameIndex>, const FString&)> OnBuilt)
+{
+    // Frames of the whole session, across every segment of the instance
+    UALS_FileLog::FlushLogFiles();
+
+    const FString LogFilePath = GetInstanceFilePath(Instance);
+    if (LogFilePath.IsEmpty())
+    {
+        OnBuilt(nullptr, TEXT("Error: Unable to find the Instance file. Please check if the file is present or has proper read permissions."));
+        return;
+    }
+
+    TWeakObjectPtr<UALS_LogsUMG> ThisWidget = this;
+
+    Async(EAsyncExecution::ThreadPool, [=]()
+        {
+            FString OutMessage;
+            TSharedPtr<FALSFrameIndex> NewIndex = FALSFrameIndex::Build(Instance, SessionID, LogFilePath, OutMessage);
+
+            AsyncTask(ENamedThreads::GameThread, [=]()
+                {
+                    if (!ThisWidget.IsValid()) return;
+
+                    if (NewIndex.IsValid())
+                    {
+                        ThisWidget->FrameIndex = NewIndex;
+                    }
+                    OnBuilt(NewIndex, OutMessage);
+                });
+        });
+}
+
+void UALS_LogsUMG::GetFrames(const FString& Instance, const FString& SessionID, bool bRefresh, FOnGetFramesCompletedDynamic OnGetFramesCompleted)
+{
+    ALS_TRACE_SCOPE(GetFrames);
+
+    if (!bRefresh && FrameIndex.IsValid() && FrameIndex->Instance == Instance && FrameIndex->SessionID == SessionID)
+    {
+        OnGetFramesCompleted.ExecuteIfBound(FrameIndex->Frames, true, TEXT("Success"));
+        return;
+    }
+
+    FrameIndex.Reset();
+
+    BuildFrameIndex(Instance, SessionID, [OnGetFramesCompleted](TSharedPtr<FALSFrameIndex> Index, const FString& OutMessage)
+        {
+            if (!Index.IsValid())
+            {
+                OnGetFramesCompleted.ExecuteIfBound({}, false, OutMessage);
+                return;
+            }
+
+            OnGetFramesCompleted.ExecuteIfBound(Index->Frames, true, TEXT("Success"));
+        });
+}
+
+void UALS_LogsUMG::GetSessionInstances(const FString& SessionID, FOnGetInstancesCompletedDynamic OnGetInstancesCompleted)
+{
+    FString OutMessage;
+    TArray<FString> AllInstances;
+    if (!GetAllInstances(AllInstances, OutMessage))
+    {
+        OnGetInstancesCompleted.ExecuteIfBound({}, false, OutMessage);
+        return;
+    }
+
+    // Anchors still queued for the background writer would otherwise hide the instances of the running session
+    UALS_FileLog::FlushLogFiles();
+
+    TArray<FString> FilePaths;
+    for (const FString& Instance : AllInstances)
+    {
+        FilePaths.Add(GetInstanceFilePath(Instance));
+    }
+
+    Async(EAsyncExecution::ThreadPool, [=]()
+        {
+            ALS_TRACE_SCOPE(GetSessionInstances);
+
+            // A session anchors every file it writes to before its first record there, so only anchor lines are parsed
+            TArray<bool> HasSession;
+            HasSession.SetNumZeroed(FilePaths.Num());
+
+            ParallelFor(FilePaths.Num(), [&](int32 i)
+                {
+                    FALSLogReader Reader(FilePaths[i]);
+                    if (!Reader.IsValid()) return;
+
+                    FString Line;
+                    FString AnchorSession;
+                    FALSClockAnchor Anchor;
+                    while (Reader.ReadLine(Line))
+                    {
+                        if (FALSLogReader::ParseAnchor(Line, AnchorSession, Anchor) && AnchorSession == SessionID)
+                        {
+                            HasSession[i] = true;
+                            return;
+                        }
+                    }
+                });
+
+            TArray<FString> Instances;
+            for (int32 i = 0; i < AllInstances.Num(); i++)
+            {
+                if (HasSession[i])
+                {
+                    Instances.Add(AllInstances[i]);
+                }
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [=]()
+                {
+                    if (Instances.IsEmpty())
+                    {
+                        OnGetInstancesCompleted.ExecuteIfBound(Instances, false, FString::Printf(TEXT("Error: No instances found for session %s"), *SessionID));
+                        return;
+                    }
+
+                    OnGetInstancesCompleted.ExecuteIfBound(Instances, true, TEXT("Success"));
+                });
+        });
+}
+
 void UALS_LogsUMG::GetFilteredLogs(
     const bool& Descending,
     const bool& bIsBatch,
@@ -324,7 +864,8 @@ void UALS_LogsUMG::GetFilteredLogs(
     const FString& Context, 
     const FString& SearchMessage, 
     const FString& SearchLevel, 
-    FOnGetLogsCompletedNative OnGetLogsCompleted
+    FOnGetLogsCompletedNative OnGetLogsCompleted,
+    bool bGroupByTemplate
 )
 {
     if (CurrentCancelToken.IsValid())
@@ -347,62 +888,86 @@ void UALS_LogsUMG::GetFilteredLogs(
     TArray<FString> Lines;
     FileContent.ParseIntoArray(Lines, TEXT("\n"), true);
 
+    // Runs still being collapsed have no trailer in the file yet, they belong to the newest segment
+    TArray<FALSRepeatRun> OpenRuns;
+    if (ViewedSegment == INDEX_NONE || ViewedSegment >= GetNumSegments(Instance) - 1)
+    {
+        UALS_FileLog::GetOpenRepeatRuns(GetInstanceFilePath(Instance), OpenRuns);
+    }
+    const FString CurrentSessionID = UALS_FileLog::GetCurrentSessionID();
+
     Async(EAsyncExecution::ThreadPool, [=]()
         {
+            ALS_TRACE_SCOPE(GetFilteredLogs);
+
             if (*CancelToken || !ThisWidget.IsValid()) return;
 
-            auto GetColumnValue = [&](TArray<FString> Cols, int32 ColIndex) -> FString
+            // Falls back to this process's anchor, which is exact when the file was written by the running session
+            FALSClockAnchor SessionAnchor = UALS_FileLog::GetClockAnchor();
+            for (const FString& Line : Lines)
+            {
+                FString AnchorSession;
+                FALSClockAnchor Anchor;
+                if (FALSLogReader::ParseAnchor(Line, AnchorSession, Anchor) && AnchorSession == SessionID)
                 {
-                    FString Value = Cols[ColIndex].TrimQuotes().TrimStartAndEnd();
-                    if (ColIndex == 6)
-                    {
-                        Value = Value.TrimStart().ReplaceEscapedCharWithChar().Replace(TEXT("-c|c-"), TEXT(","));
-                    }
-                    return Value;
-                };
+                    SessionAnchor = Anchor;
+                    break;
+                }
+            }
 
             TArray<FLogEntries> LocalEntries;
             LocalEntries.Reserve(Lines.Num());
 
             FCriticalSection Mutex;
 
-            ParallelFor(Lines.Num(), [&](int32 i)
+            auto AddRecord = [&](const FALSLogRecord& Record)
                 {
-                    if (*CancelToken || !ThisWidget.IsValid()) return;
-
-                    const FString& Line = Lines[i];
-                    if (Line.IsEmpty()) return;
-
-                    TArray<FString> Cols;
-                    Line.ParseIntoArray(Cols, TEXT("-|ALS|-"), false);
-                    if (Cols.Num() < 7) return;
-
-                    const uint64 LoggedCycle = FCString::Strtoui64(*GetColumnValue(Cols, 0), nullptr, 10);
-                    const FString LoggedTime = GetColumnValue(Cols, 1);
-                    const FString LoggedSession = GetColumnValue(Cols, 2);
-                    const FString LoggedContext = GetColumnValue(Cols, 3);
-                    const FString LoggedSource = GetColumnValue(Cols, 4);
-                    const FString LoggedLevel = GetColumnValue(Cols, 5);
-                    const FString LoggedMessage = GetColumnValue(Cols, 6);
+                    if (Record.Session != SessionID || Record.Context != Context) return;
 
-                    if (LoggedSession != SessionID || LoggedContext != Context) return;
-
-                    if ((!SearchMessage.IsEmpty() && !LoggedMessage.Contains(SearchMessage)) ||
-                        (!SearchLevel.Contains(TEXT("All Levels")) && LoggedLevel != SearchLevel))
+                    if ((!SearchMessage.IsEmpty() && !Record.Message.Contains(SearchMessage)) ||
+                        (!SearchLevel.Contains(TEXT("All Levels")) && Record.Level != SearchLevel))
                     {
                         return;
                     }
 
-                    FDateTime ParsedTime;
-                    if (!FDateTime::Parse(LoggedTime, ParsedTime)) return;
+                    int64 UnixNs;
+                    FDateTime LocalTime;
+                    if (!FALSLogReader::ResolveTime(Record, SessionAnchor, UnixNs, LocalTime)) return;
 
                     {
                         FScopeLock Lock(&Mutex);
-                        LocalEntries.Add(FLogEntries(LoggedLevel, LoggedMessage, LoggedSource, ParsedTime, LoggedCycle));
+                        FLogEntries& Entry = LocalEntries.Add_GetRef(FLogEntries(Record.Level, Record.Message, Record.Source, LocalTime, UnixNs));
+                        Entry.Frame = Record.Frame;
+                        ALSLogsUMG::ApplyRepeats(Record, SessionAnchor, Entry);
                     }   
+                };
+
+            ParallelFor(Lines.Num(), [&](int32 i)
+                {
+                    if (*CancelToken || !ThisWidget.IsValid()) return;
+
+                    FALSLogRecord Record;
+                    if (!FALSLogReader::ParseRecord(Lines[i], Record)) return;
+
+                    AddRecord(Record);
                 });
 
-            if (bIsBatch)
+            for (const FALSRepeatRun& Run : OpenRuns)
+            {
+                AddRecord(ALSLogsUMG::ToRecord(Run, CurrentSessionID));
+            }
+
+            if (bGroupByTemplate)
+            {
+                LocalEntries = FALSLogTemplates::Mine(LocalEntries);
+
+                for (FLogEntries& Entry : LocalEntries)
+                {
+                    ALSLogsUMG::SetPeriodMessage(Entry);
+                    Entry.DateTime = FALSTimeFormat::FormatDateTime(Entry.StartTime);
+                }
+            }
+            else if (bIsBatch)
             {
                 TMap<FALSKey, FLogEntries> UniqueMap;
                 UniqueMap.Reserve(LocalEntries.Num());
@@ -414,10 +979,11 @@ void UALS_LogsUMG::GetFilteredLogs(
                     FLogEntries* Found = UniqueMap.Find(Key);
                     if (Found)
                     {
-                        Found->Count++;
+                        Found->Count += E.Count;
                         Found->StartTime = FMath::Min(Found->StartTime, E.StartTime);
                         Found->EndTime = FMath::Max(Found->EndTime, E.EndTime);
-                        Found->CycleCounter = FMath::Min<uint64>(Found->CycleCounter, E.CycleCounter);
+                        Found->Frame = E.Timestamp < Found->Timestamp ? E.Frame : Found->Frame;
+                        Found->Timestamp = FMath::Min<int64>(Found->Timestamp, E.Timestamp);
                     }
                     else
                     {
@@ -434,25 +1000,21 @@ void UALS_LogsUMG::GetFilteredLogs(
 
                     if (Entry.Count > 1)
                     {
-                        Entry.PeriodMessage = FString::Printf(
-                            TEXT("(%d times logged from %s to %s)"),
-                            Entry.Count,
-                            *Entry.StartTime.ToString(TEXT("%H:%M:%S")),
-                            *Entry.EndTime.ToString(TEXT("%H:%M:%S")));
+                        ALSLogsUMG::SetPeriodMessage(Entry);
                     }
 
-                    Entry.DateTime = Entry.StartTime.ToFormattedString(TEXT("%d:%m:%Y %H:%M:%S"));
+                    Entry.DateTime = FALSTimeFormat::FormatDateTime(Entry.StartTime);
 
                     LocalEntries.Add(MoveTemp(Entry));
                 }
             }
 
-            auto ByCycle = [](const FLogEntries& A, const FLogEntries& B)
+            auto ByTimestamp = [](const FLogEntries& A, const FLogEntries& B)
                 {
-                    return A.CycleCounter < B.CycleCounter;
+                    return A.Timestamp < B.Timestamp;
                 };
 
-            Algo::Sort(LocalEntries, ByCycle); 
+            Algo::Sort(LocalEntries, ByTimestamp); 
 
             if (Descending)
             {
@@ -470,6 +1032,199 @@ void UALS_LogsUMG::GetFilteredLogs(
     return;
 }
 
+void UALS_LogsUMG::GetMergedLogs(
+    const bool& Descending,
+    const TArray<FString>& Instances,
+    const FString& SessionID,
+    const FString& SearchMessage,
+    const FString& SearchLevel,
+    FOnGetLogsCompletedNative OnGetLogsCompleted
+)
+{
+    if (CurrentCancelToken.IsValid())
+    {
+        *CurrentCancelToken = true;
+    }
+
+    CurrentCancelToken = MakeShared<bool>(false);
+    TSharedPtr<bool> CancelToken = CurrentCancelToken;
+    TWeakObjectPtr<UALS_LogsUMG> ThisWidget = this;
+
+    // Records still queued for the background writer would otherwise be missing from the timeline
+    UALS_FileLog::FlushLogFiles();
+    const FString CurrentSessionID = UALS_FileLog::GetCurrentSessionID();
+
+    struct FMergeSource
+    {
+        FString Instance;
+        FString FilePath;
+
+        // Runs still being collapsed have no trailer in the file yet
+        TArray<FALSRepeatRun> OpenRuns;
+    };
+
+    TArray<FMergeSource> InstanceFiles;
+    for (const FString& Instance : Instances)
+    {
+        FString FilePath = GetInstanceFilePath(Instance);
+        if (FilePath.IsEmpty())
+        {
+            UE_LOG(LogALS, Warning, TEXT("Merged Timeline: Unable to find the Instance file for %s"), *Instance);
+            continue;
+        }
+
+        FMergeSource& Source = InstanceFiles.AddDefaulted_GetRef();
+        Source.Instance = Instance;
+        Source.FilePath = FilePath;
+        UALS_FileLog::GetOpenRepeatRuns(FilePath, Source.OpenRuns);
+    }
+
+    if (InstanceFiles.IsEmpty())
+    {
+        UE_LOG(LogALS, Error, TEXT("Merged Timeline: No valid instance files to merge"));
+        return;
+    }
+
+    Async(EAsyncExecution::ThreadPool, [=]()
+        {
+            ALS_TRACE_SCOPE(GetMergedLogs);
+
+            if (*CancelToken || !ThisWidget.IsValid()) return;
+
+            // Each instance file is streamed through its own reader, only the next pending entry per file is kept in memory.
+            // Open runs of an instance get a cursor of their own, sorted by their last repeat like the trailers they will become
+            struct FMergeCursor
+            {
+                FString Instance;
+                TUniquePtr<FALSLogReader> Reader;
+                TArray<FALSLogRecord> OpenRecords;
+                int32 NextOpenRecord = 0;
+                FALSClockAnchor Anchor = UALS_FileLog::GetClockAnchor();
+                FLogEntries Current;
+            };
+
+            TArray<FMergeCursor> Cursors;
+            Cursors.Reserve(InstanceFiles.Num() * 2);
+
+            for (const FMergeSource& Source : InstanceFiles)
+            {
+                FMergeCursor& Cursor = Cursors.AddDefaulted_GetRef();
+                Cursor.Instance = Source.Instance;
+                Cursor.Reader = MakeUnique<FALSLogReader>(Source.FilePath);
+
+                if (!Source.OpenRuns.IsEmpty())
+                {
+                    FMergeCursor& RunCursor = Cursors.AddDefaulted_GetRef();
+                    RunCursor.Instance = Source.Instance;
+                    for (const FALSRepeatRun& Run : Source.OpenRuns)
+                    {
+                        RunCursor.OpenRecords.Add(ALSLogsUMG::ToRecord(Run, CurrentSessionID));
+                    }
+                    Algo::SortBy(RunCursor.OpenRecords, &FALSLogRecord::Timestamp);
+                }
+            }
+
+            auto SetCurrent = [&](FMergeCursor& Cursor, const FALSLogRecord& Record) -> bool
+                {
+                    if (Record.Session != SessionID) return false;
+
+                    if ((!SearchMessage.IsEmpty() && !Record.Message.Contains(SearchMessage)) ||
+                        (!SearchLevel.Contains(TEXT("All Levels")) && Record.Level != SearchLevel))
+                    {
+                        return false;
+                    }
+
+                    int64 UnixNs;
+                    FDateTime LocalTime;
+                    if (!FALSLogReader::ResolveTime(Record, Cursor.Anchor, UnixNs, LocalTime)) return false;
+
+                    Cursor.Current = FLogEntries(Record.Level, Record.Message, Record.Source, LocalTime, UnixNs);
+                    Cursor.Current.Frame = Record.Frame;
+                    ALSLogsUMG::ApplyRepeats(Record, Cursor.Anchor, Cursor.Current);
+                    Cursor.Current.Instance = Cursor.Instance;
+                    Cursor.Current.Context = Record.Context;
+                    return true;
+                };
+
+            auto Advance = [&](FMergeCursor& Cursor) -> bool
+                {
+                    while (Cursor.NextOpenRecord < Cursor.OpenRecords.Num())
+                    {
+                        if (SetCurrent(Cursor, Cursor.OpenRecords[Cursor.NextOpenRecord++])) return true;
+                    }
+
+                    if (!Cursor.Reader.IsValid() || !Cursor.Reader->IsValid()) return false;
+
+                    FString Line;
+                    FALSLogRecord Record;
+
+                    FString AnchorSession;
+                    FALSClockAnchor Anchor;
+
+                    while (Cursor.Reader->ReadLine(Line))
+                    {
+                        if (*CancelToken) return false;
+
+                        if (FALSLogReader::ParseAnchor(Line, AnchorSession, Anchor))
+                        {
+                            if (AnchorSession == SessionID)
+                            {
+                                Cursor.Anchor = Anchor;
+                            }
+                            continue;
+                        }
+
+                        if (FALSLogReader::ParseRecord(Line, Record) && SetCurrent(Cursor, Record)) return true;
+                    }
+
+                    return false;
+                };
+
+            // Instances of one process share the same anchor, so their order is exact rather than wall-clock accurate
+            auto ByTime = [&Cursors](const int32 A, const int32 B)
+                {
+                    return Cursors[A].Current.Timestamp < Cursors[B].Current.Timestamp;
+                };
+
+            TArray<int32> Heap;
+            Heap.Reserve(Cursors.Num());
+
+            for (int32 i = 0; i < Cursors.Num(); i++)
+            {
+                if (Advance(Cursors[i]))
+                {
+                    Heap.HeapPush(i, ByTime);
+                }
+            }
+
+            TArray<FLogEntries> MergedEntries;
+
+            while (Heap.Num() > 0)
+            {
+                if (*CancelToken || !ThisWidget.IsValid()) return;
+
+                int32 Index;
+                Heap.HeapPop(Index, ByTime, false);
+                MergedEntries.Add(MoveTemp(Cursors[Index].Current));
+
+                if (Advance(Cursors[Index]))
+                {
+                    Heap.HeapPush(Index, ByTime);
+                }
+            }
+
+            if (Descending)
+            {
+                Algo::Reverse(MergedEntries);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [=]()
+                {
+                    OnGetLogsCompleted.ExecuteIfBound(MergedEntries);
+                });
+        });
+}
+
 void UALS_LogsUMG::GetMessageObjects(
     const UALS_LogContextObject* ContextObject, 
     const bool& bDescending, 
@@ -512,6 +1267,142 @@ void UALS_LogsUMG::GetMessageObjects(
     );
 }
 
+void UALS_LogsUMG::GetTemplateMessageObjects(
+    const UALS_LogContextObject* ContextObject, 
+    const bool& bDescending, 
+    FOnGetLogsCompletedDynamic OnGetLogsCompleted
+)
+{
+    FOnGetLogsCompletedNative NativeDelegate;
+    NativeDelegate.BindLambda([=](const TArray<FLogEntries>& Templates)
+        {
+            TArray<UALS_LogMsgObject*> MessageObjects;
+            for (const FLogEntries& Entry : Templates)
+            {
+                UALS_LogMsgObject* MessageObject = NewObject<UALS_LogMsgObject>();
+                MessageObject->SetMessageEntry(Entry, true);
+                MessageObjects.Add(MessageObject);
+            }
+
+            if (MessageObjects.Num() > UALS_Settings::Get()->MaxNumberOfListsToCreate)
+            {
+                FString OutMessage = FString::Printf(
+                    TEXT("Warning: The number of templates is large. Creating this many list entries may consume more memory.\nCaution: Would you still like to proceed with these templates? "));
+                OnGetLogsCompleted.ExecuteIfBound(MessageObjects, false, OutMessage);
+                return;
+            }
+
+            OnGetLogsCompleted.ExecuteIfBound(MessageObjects, true, TEXT("Success"));
+            return;
+        });
+
+    GetFilteredLogs(
+        bDescending,
+        false,
+        ContextObject->Instance,
+        ContextObject->SessionID,
+        ContextObject->Context,
+        ContextObject->SearchMessage,
+        ContextObject->SearchLevel,
+        NativeDelegate,
+        true
+    );
+}
+
+void UALS_LogsUMG::GetMergedMessageObjects(
+    const TArray<FString>& Instances,
+    const FString& SessionID,
+    const FString& SearchMessage,
+    const FString& SearchLevel,
+    const bool& bDescending,
+    FOnGetLogsCompletedDynamic OnGetLogsCompleted
+)
+{
+    FOnGetLogsCompletedNative NativeDelegate;
+    NativeDelegate.BindLambda([=](const TArray<FLogEntries>& Merged)
+        {
+            TArray<UALS_LogMsgObject*> MessageObjects;
+            for (const FLogEntries& Entry : Merged)
+            {
+                UALS_LogMsgObject* MessageObject = NewObject<UALS_LogMsgObject>();
+                MessageObject->SetMessageEntry(Entry, false);
+                MessageObjects.Add(MessageObject);
+            }
+
+            if (MessageObjects.Num() > UALS_Settings::Get()->MaxNumberOfListsToCreate)
+            {
+                FString OutMessage = FString::Printf(
+                    TEXT("Warning: The merged timeline is large. Creating this many list entries may consume more memory.\nCaution: Would you still like to proceed with the merged timeline? "));
+                OnGetLogsCompleted.ExecuteIfBound(MessageObjects, false, OutMessage);
+                return;
+            }
+
+            OnGetLogsCompleted.ExecuteIfBound(MessageObjects, true, TEXT("Success"));
+        });
+
+    GetMergedLogs(bDescending, Instances, SessionID, SearchMessage, SearchLevel, NativeDelegate);
+}
+
+void UALS_LogsUMG::GetFrameMessageObjects(
+    const FString& Instance,
+    const FString& SessionID,
+    int64 Frame,
+    FOnGetLogsCompletedDynamic OnGetLogsCompleted
+)
+{
+    ALS_TRACE_SCOPE(GetFrameMessageObjects);
+
+    TWeakObjectPtr<UALS_LogsUMG> ThisWidget = this;
+
+    // The frame's records are read back by offset on a worker thread, only the message objects are created on the game thread
+    auto ReadFrame = [ThisWidget, Frame, OnGetLogsCompleted](TSharedPtr<FALSFrameIndex> Index)
+        {
+            Async(EAsyncExecution::ThreadPool, [=]()
+                {
+                    TArray<FLogEntries> Entries;
+                    const bool bRead = Index->ReadFrame(Frame, Entries);
+
+                    AsyncTask(ENamedThreads::GameThread, [=]()
+                        {
+                            if (!ThisWidget.IsValid()) return;
+
+                            if (!bRead)
+                            {
+                                OnGetLogsCompleted.ExecuteIfBound({}, false, FString::Printf(TEXT("Error: Frame %lld has no records"), Frame));
+                                return;
+                            }
+
+                            TArray<UALS_LogMsgObject*> MessageObjects;
+                            for (const FLogEntries& Entry : Entries)
+                            {
+                                UALS_LogMsgObject* MessageObject = NewObject<UALS_LogMsgObject>();
+                                MessageObject->SetMessageEntry(Entry, false);
+                                MessageObjects.Add(MessageObject);
+                            }
+
+                            OnGetLogsCompleted.ExecuteIfBound(MessageObjects, true, TEXT("Success"));
+                        });
+                });
+        };
+
+    if (FrameIndex.IsValid() && FrameIndex->Instance == Instance && FrameIndex->SessionID == SessionID)
+    {
+        ReadFrame(FrameIndex);
+        return;
+    }
+
+    BuildFrameIndex(Instance, SessionID, [ReadFrame, OnGetLogsCompleted](TSharedPtr<FALSFrameIndex> Index, const FString& OutMessage)
+        {
+            if (!Index.IsValid())
+            {
+                OnGetLogsCompleted.ExecuteIfBound({}, false, OutMessage);
+                return;
+            }
+
+            ReadFrame(Index);
+        });
+}
+
 void UALS_LogsUMG::SetContextObjects(
     UListView* ContextList,
     const TArray<FContextEntries>& Entries, 
@@ -0,0 +1,200 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_Metrics.h"
+#include "ALS.h"
+#include "ALS_FileLog.h"
+#include "ALS_Settings.h"
+#include "ALS_NumberFormat.h"
+#include "Misc/StringBuilder.h"
+
+FALSMetrics::FShard::FShard()
+{
+    for (int32 i = 0; i < MaxMetrics; ++i)
+    {
+        Counters[i].store(0, std::memory_order_relaxed);
+        GaugeStamps[i].store(0, std::memory_order_relaxed);
+        Gauges[i].store(0.0, std::memory_order_relaxed);
+    }
+}
+
+FALSMetrics::FShardHandle::~FShardHandle()
+{
+    if (!Shard) return;
+
+    {
+        FScopeLock Lock(&RegistryLock);
+
+        for (int32 i = 0; i < MaxMetrics; ++i)
+        {
+            RetiredShard.Counters[i].fetch_add(Shard->Counters[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            const uint64 Stamp = Shard->GaugeStamps[i].load(std::memory_order_relaxed);
+            if (Stamp > RetiredShard.GaugeStamps[i].load(std::memory_order_relaxed))
+            {
+                RetiredShard.GaugeStamps[i].store(Stamp, std::memory_order_relaxed);
+                RetiredShard.Gauges[i].store(Shard->Gauges[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+        }
+
+        Shards.RemoveSingleSwap(Shard);
+    }
+
+    delete Shard;
+}
+
+FALSMetrics::FShard& FALSMetrics::GetShard()
+{
+    static thread_local FShardHandle Handle;
+
+    if (!Handle.Shard)
+    {
+        Handle.Shard = new FShard();
+
+        FScopeLock Lock(&RegistryLock);
+        Shards.Add(Handle.Shard);
+    }
+
+    return *Handle.Shard;
+}
+
+int32 FALSMetrics::RegisterMetric(const TCHAR* Name, EALSMetricType Type)
+{
+    FScopeLock Lock(&RegistryLock);
+
+    const int32 Existing = Metrics.IndexOfByPredicate([Name](const FMetricInfo& Info) { return Info.Name == Name; });
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    if (Metrics.Num() >= MaxMetrics)
+    {
+        UE_LOG(LogALS, Warning, TEXT("ALS metric %s ignored, all %d metric slots are taken"), Name, MaxMetrics);
+        return INDEX_NONE;
+    }
+
+    FMetricInfo& Info = Metrics.AddDefaulted_GetRef();
+    Info.Name = Name;
+    Info.Type = Type;
+    return Metrics.Num() - 1;
+}
+
+void FALSMetrics::AddCounter(int32 MetricId, int64 Delta)
+{
+    if (MetricId < 0 || MetricId >= MaxMetrics) return;
+
+    // Only this thread writes the slot, the flush only reads it
+    std::atomic<int64>& Slot = GetShard().Counters[MetricId];
+    Slot.store(Slot.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+}
+
+void FALSMetrics::SetGauge(int32 MetricId, double Value)
+{
+    if (MetricId < 0 || MetricId >= MaxMetrics) return;
+
+    FShard& Shard = GetShard();
+    Shard.Gauges[MetricId].store(Value, std::memory_order_relaxed);
+    Shard.GaugeStamps[MetricId].store(FPlatformTime::Cycles64(), std::memory_order_release);
+}
+
+void FALSMetrics::StartSummaries()
+{
+    if (SummaryTickerHandle.IsValid()) return;
+
+    const float Interval = FMath::Max(UALS_Settings::Get()->SummaryInterval, 1.0f);
+    SummaryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(TEXT("ALSMetricSummaries"), Interval, [](float DeltaTime)
+        {
+            FlushSummaries();
+            return true;
+        });
+}
+
+void FALSMetrics::StopSummaries()
+{
+    if (!SummaryTickerHandle.IsValid()) return;
+
+    FTSTicker::GetCoreTicker().RemoveTicker(SummaryTickerHandle);
+    SummaryTickerHandle.Reset();
+
+    FlushSummaries();
+}
+
+void FALSMetrics::FlushSummaries()
+{
+    TStringBuilder<512> Message;
+    {
+        FScopeLock Lock(&RegistryLock);
+
+        for (int32 MetricId = 0; MetricId < Metrics.Num(); ++MetricId)
+        {
+            FMetricInfo& Info = Metrics[MetricId];
+
+            if (Info.Type == EALSMetricType::Counter)
+            {
+                int64 Total = RetiredShard.Counters[MetricId].load(std::memory_order_relaxed);
+                for (const FShard* Shard : Shards)
+                {
+                    Total += Shard->Counters[MetricId].load(std::memory_order_relaxed);
+                }
+
+                const int64 Delta = Total - Info.FlushedTotal;
+                if (Delta == 0) continue;
+
+                Info.FlushedTotal = Total;
+
+                Message.Append(Message.Len() > 0 ? TEXT(" | counter ") : TEXT("counter "));
+                Message.Append(Info.Name);
+                Message.AppendChar(TEXT(' '));
+                FALSNumberFormat::AppendInt(Message, Delta);
+            }
+            else
+            {
+                uint64 Stamp = RetiredShard.GaugeStamps[MetricId].load(std::memory_order_relaxed);
+                double Value = RetiredShard.Gauges[MetricId].load(std::memory_order_relaxed);
+                for (const FShard* Shard : Shards)
+                {
+                    const uint64 ShardStamp = Shard->GaugeStamps[MetricId].load(std::memory_order_acquire);
+                    if (ShardStamp > Stamp)
+                    {
+                        Stamp = ShardStamp;
+                        Value = Shard->Gauges[MetricId].load(std::memory_order_relaxed);
+                    }
+                }
+
+                if (Stamp <= Info.FlushedStamp) continue;
+
+                Info.FlushedStamp = Stamp;
+
+                Message.Append(Message.Len() > 0 ? TEXT(" | gauge ") : TEXT("gauge "));
+                Message.Append(Info.Name);
+                Message.AppendChar(TEXT(' '));
+                FALSNumberFormat::AppendFixed(Message, Value, 3);
+            }
+        }
+    }
+
+    if (Message.Len() > 0)
+    {
+        UALS_FileLog::CreateSummaryLog(SummaryCaller, TEXT("Metrics"), Message.ToView());
+    }
+}
+
+bool FALSMetrics::ParseSummary(const FString& Message, TArray<FALSMetricSample>& OutSamples)
+{
+    TArray<FString> Fields;
+    Message.ParseIntoArray(Fields, TEXT(" | "), true);
+
+    for (const FString& Field : Fields)
+    {
+        TArray<FString> Parts;
+        Field.ParseIntoArrayWS(Parts);
+        if (Parts.Num() != 3) continue;
+
+        FALSMetricSample& Sample = OutSamples.AddDefaulted_GetRef();
+        Sample.Type = Parts[0] == TEXT("gauge") ? EALSMetricType::Gauge : EALSMetricType::Counter;
+        Sample.Name = Parts[1];
+        Sample.Value = FCString::Atod(*Parts[2]);
+    }
+
+    return !OutSamples.IsEmpty();
+}
@@ -0,0 +1,142 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_NumberFormat.h"
+#include <cmath>
+
+namespace ALSNumberFormat
+{
+    static constexpr TCHAR DigitPairs[] =
+        TEXT("00010203040506070809")
+        TEXT("10111213141516171819")
+        TEXT("20212223242526272829")
+        TEXT("30313233343536373839")
+        TEXT("40414243444546474849")
+        TEXT("50515253545556575859")
+        TEXT("60616263646566676869")
+        TEXT("70717273747576777879")
+        TEXT("80818283848586878889")
+        TEXT("90919293949596979899");
+
+    static constexpr uint64 Pow10[] = { 1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull };
+
+    // From 2^52 on the spacing of doubles is 1 or more, so Floor + 0.5 and the tie check are no longer exact
+    static constexpr double MaxScaledValue = 4503599627370496.0;
+
+    // Writes Value right aligned into the end of Buffer, padded with zeros to MinDigits, and returns the first written character
+    static TCHAR* WriteDigits(TCHAR* BufferEnd, uint64 Value, int32 MinDigits)
+    {
+        TCHAR* Out = BufferEnd;
+
+        while (Value >= 100)
+        {
+            const int32 Pair = static_cast<int32>(Value % 100) * 2;
+            Value /= 100;
+            *--Out = DigitPairs[Pair + 1];
+            *--Out = DigitPairs[Pair];
+        }
+
+        if (Value >= 10)
+        {
+            const int32 Pair = static_cast<int32>(Value) * 2;
+            *--Out = DigitPairs[Pair + 1];
+            *--Out = DigitPairs[Pair];
+        }
+        else
+        {
+            *--Out = TEXT('0') + static_cast<TCHAR>(Value);
+        }
+
+        while (BufferEnd - Out < MinDigits)
+        {
+            *--Out = TEXT('0');
+        }
+
+        return Out;
+    }
+}
+
+void FALSNumberFormat::AppendUInt(FStringBuilderBase& OutBuilder, uint64 Value)
+{
+    TCHAR Buffer[20];
+    TCHAR* const BufferEnd = Buffer + UE_ARRAY_COUNT(Buffer);
+    const TCHAR* Start = ALSNumberFormat::WriteDigits(BufferEnd, Value, 1);
+
+    OutBuilder.Append(Start, static_cast<int32>(BufferEnd - Start));
+}
+
+void FALSNumberFormat::AppendInt(FStringBuilderBase& OutBuilder, int64 Value)
+{
+    if (Value < 0)
+    {
+        OutBuilder.AppendChar(TEXT('-'));
+
+        // Negated in unsigned space so INT64_MIN does not overflow
+        AppendUInt(OutBuilder, 0ull - static_cast<uint64>(Value));
+        return;
+    }
+
+    AppendUInt(OutBuilder, static_cast<uint64>(Value));
+}
+
+void FALSNumberFormat::AppendFixed(FStringBuilderBase& OutBuilder, double Value, int32 Precision)
+{
+    Precision = FMath::Clamp(Precision, 0, MaxPrecision);
+
+    const double Magnitude = std::fabs(Value);
+    const double Scale = static_cast<double>(ALSNumberFormat::Pow10[Precision]);
+    const double Scaled = Magnitude * Scale;
+    if (!FMath::IsFinite(Value) || Scaled >= ALSNumberFormat::MaxScaledValue)
+    {
+        OutBuilder.Appendf(TEXT("%.*f"), Precision, Value);
+        return;
+    }
+
+    // The product is rounded, so the floor and the tie are decided on the exact product with fma. Ties round to even like printf
+    double Floor = std::floor(Scaled);
+    if (std::fma(Magnitude, Scale, -Floor) < 0.0)
+    {
+        Floor -= 1.0;
+    }
+
+    uint64 Rounded = static_cast<uint64>(Floor);
+    const double Remainder = std::fma(Magnitude, Scale, -(Floor + 0.5));
+    if (Remainder > 0.0 || (Remainder == 0.0 && (Rounded & 1)))
+    {
+        Rounded++;
+    }
+    const uint64 IntegerPart = Rounded / ALSNumberFormat::Pow10[Precision];
+    const uint64 FractionPart = Rounded % ALSNumberFormat::Pow10[Precision];
+
+    // Integer digits, the dot and the fraction are laid out back to front in one buffer and appended at once
+    TCHAR Buffer[32];
+    TCHAR* const BufferEnd = Buffer + UE_ARRAY_COUNT(Buffer);
+    TCHAR* Start = BufferEnd;
+
+    if (Precision > 0)
+    {
+        Start = ALSNumberFormat::WriteDigits(Start, FractionPart, Precision);
+        *--Start = TEXT('.');
+    }
+
+    Start = ALSNumberFormat::WriteDigits(Start, IntegerPart, 1);
+
+    // printf keeps the sign of values that round to zero, "-0.000000"
+    if (std::signbit(Value))
+    {
+        *--Start = TEXT('-');
+    }
+
+    OutBuilder.Append(Start, static_cast<int32>(BufferEnd - Start));
+}
+
+void FALSNumberFormat::AppendComponents(FStringBuilderBase& OutBuilder, std::initializer_list<const TCHAR*> Labels, std::initializer_list<double> Values, int32 Precision)
+{
+    check(Labels.size() == Values.size());
+
+    const TCHAR* const* Label = Labels.begin();
+    for (const double Value : Values)
+    {
+        OutBuilder.Append(*Label++);
+        AppendFixed(OutBuilder, Value, Precision);
+    }
+}
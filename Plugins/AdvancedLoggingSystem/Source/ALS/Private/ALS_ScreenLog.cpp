@@ -0,0 +1,152 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_ScreenLog.h"
+#include "ALS_Settings.h"
+#include "ALS_Stats.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "Debug/DebugDrawService.h"
+#include "SceneInterface.h"
+#include "SceneView.h"
+
+bool UALS_ScreenLogSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+    // Engine screen messages are compiled out of Shipping as well
+    return false;
+#else
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UALS_ScreenLogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UALS_ScreenLogSubsystem::DrawLines));
+}
+
+void UALS_ScreenLogSubsystem::Deinitialize()
+{
+    UDebugDrawService::Unregister(DrawHandle);
+
+    DEC_DWORD_STAT_BY(STAT_ALS_ScreenLines, Lines.Num());
+    Lines.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UALS_ScreenLogSubsystem::AddMessage(
+    const UObject* Context,
+    const FString& SourceID,
+    const FString& Text,
+    const FName& Key,
+    float Duration,
+    const FColor& Color)
+{
+    if (!GEngine) return false;
+
+    UWorld* World = GEngine->GetWorldFromContextObject(Context, EGetWorldErrorMode::ReturnNull);
+    UALS_ScreenLogSubsystem* ScreenLog = World ? World->GetSubsystem<UALS_ScreenLogSubsystem>() : nullptr;
+    if (!ScreenLog) return false;
+
+    // A Key always owns its line, like the engine's message keys. Without one, the same text from the same source is counted instead of repeated
+    if (Key != NAME_None)
+    {
+        ScreenLog->AddLine(GetTypeHash(Key), true, Text, Duration, Color);
+    }
+    else
+    {
+        ScreenLog->AddLine(HashCombine(GetTypeHash(SourceID), GetTypeHash(Text)), false, Text, Duration, Color);
+    }
+
+    return true;
+}
+
+void UALS_ScreenLogSubsystem::AddLine(uint32 LineKey, bool bKeyed, const FString& Text, float Duration, const FColor& Color)
+{
+    const double ExpireTime = FPlatformTime::Seconds() + FMath::Max(Duration, 0.0f);
+
+    FALSScreenLine* Line = Lines.FindByPredicate([LineKey, bKeyed, &Text](const FALSScreenLine& Existing)
+        {
+            return Existing.LineKey == LineKey && Existing.bKeyed == bKeyed && (bKeyed || Existing.Text == Text);
+        });
+
+    if (Line)
+    {
+        if (bKeyed)
+        {
+            Line->Text = Text;
+            Line->DisplayText = Text;
+        }
+        else
+        {
+            Line->Count++;
+            ALS_STAT_ADD(ScreenCoalesced, 1);
+            Line->DisplayText = FString::Printf(TEXT("%s  ×%d"), *Line->Text, Line->Count);
+        }
+
+        Line->Color = Color;
+        Line->ExpireTime = ExpireTime;
+        Line->bDrawn = false;
+        return;
+    }
+
+    FALSScreenLine& NewLine = Lines.InsertDefaulted_GetRef(0);
+    NewLine.LineKey = LineKey;
+    NewLine.bKeyed = bKeyed;
+    NewLine.Text = Text;
+    NewLine.DisplayText = Text;
+    NewLine.Color = Color;
+    NewLine.ExpireTime = ExpireTime;
+    INC_DWORD_STAT(STAT_ALS_ScreenLines);
+
+    const int32 MaxLines = FMath::Max(UALS_Settings::Get()->MaxScreenLines, 1);
+    if (Lines.Num() > MaxLines)
+    {
+        ALS_STAT_ADD(ScreenDropped, Lines.Num() - MaxLines);
+        DEC_DWORD_STAT_BY(STAT_ALS_ScreenLines, Lines.Num() - MaxLines);
+        Lines.SetNum(MaxLines);
+    }
+}
+
+void UALS_ScreenLogSubsystem::DrawLines(UCanvas* Canvas, APlayerController* PlayerController)
+{
+    if (!Canvas || !GEngine) return;
+
+    // Every game viewport calls in, only draw into the ones showing this world
+    const FSceneInterface* Scene = Canvas->SceneView && Canvas->SceneView->Family ? Canvas->SceneView->Family->Scene : nullptr;
+    if (!Scene || Scene->GetWorld() != GetWorld()) return;
+
+    const double Now = FPlatformTime::Seconds();
+    const int32 NumExpired = Lines.RemoveAll([Now](const FALSScreenLine& Line)
+        {
+            // Zero duration lines still get one frame on screen
+            return Line.bDrawn && Line.ExpireTime <= Now;
+        });
+
+    DEC_DWORD_STAT_BY(STAT_ALS_ScreenLines, NumExpired);
+
+    if (Lines.IsEmpty() || !GEngine->bEnableOnScreenDebugMessages || !GAreScreenMessagesEnabled) return;
+
+    UFont* Font = GEngine->GetSmallFont();
+    const float LineHeight = Font->GetMaxCharHeight();
+    const float X = Canvas->ClipX * 0.02f;
+    float Y = Canvas->ClipY * 0.1f;
+
+    FFontRenderInfo RenderInfo;
+    RenderInfo.bEnableShadow = true;
+
+    // Canvas batches text items sharing the same font, so all lines end up in one draw
+    for (FALSScreenLine& Line : Lines)
+    {
+        Line.bDrawn = true;
+        if (Y > Canvas->ClipY) continue;
+
+        Canvas->SetDrawColor(Line.Color);
+        Canvas->DrawText(Font, Line.DisplayText, X, Y, 1.0f, 1.0f, RenderInfo);
+        Y += LineHeight;
+    }
+}
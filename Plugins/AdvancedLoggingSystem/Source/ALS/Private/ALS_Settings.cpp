@@ -1,6 +1,7 @@
 ﻿//Copyright © 2025 RTerofer. All Rights Reserved.
 
 #include "ALS_Settings.h"
+#include "CoreGlobals.h"
 
 FName UALS_Settings::GetCategoryName() const
 {
@@ -63,3 +64,13 @@ bool UALS_Settings::IsPropertyInspectorAllowed()
     return true;
 #endif
 }
+
+bool UALS_Settings::IsSeverityStrippedInCook(ELogSeverity Severity)
+{
+    if (!IsRunningCookCommandlet() || !UALS_Settings::Get()->bStripNodesInCook)
+    {
+        return false;
+    }
+
+    return Severity < UALS_Settings::Get()->MinimumCookedSeverity;
+}
@@ -0,0 +1,25 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_Stats.h"
+
+DEFINE_STAT(STAT_ALS_Print);
+DEFINE_STAT(STAT_ALS_Draw);
+DEFINE_STAT(STAT_ALS_Format);
+DEFINE_STAT(STAT_ALS_FileWrite);
+DEFINE_STAT(STAT_ALS_InspectorTick);
+
+DEFINE_STAT(STAT_ALS_Messages);
+DEFINE_STAT(STAT_ALS_FileRecords);
+DEFINE_STAT(STAT_ALS_FileBytes);
+DEFINE_STAT(STAT_ALS_ScreenCoalesced);
+DEFINE_STAT(STAT_ALS_ScreenDropped);
+DEFINE_STAT(STAT_ALS_InspectorTicked);
+DEFINE_STAT(STAT_ALS_InspectorSkipped);
+
+DEFINE_STAT(STAT_ALS_ScreenLines);
+DEFINE_STAT(STAT_ALS_WorldTextSlots);
+DEFINE_STAT(STAT_ALS_FileQueueDepth);
+DEFINE_STAT(STAT_ALS_PendingScreenPrints);
+DEFINE_STAT(STAT_ALS_WorldTextMemory);
+
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, ALS, true);
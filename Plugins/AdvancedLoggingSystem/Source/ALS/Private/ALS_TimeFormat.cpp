@@ -0,0 +1,43 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_TimeFormat.h"
+
+namespace ALSTimeFormat
+{
+    struct FSecondCache
+    {
+        int64 Second = -1;
+        FString DateTime;
+        FString TimeOfDay;
+    };
+
+    static FSecondCache& GetCache(const FDateTime& Time)
+    {
+        static thread_local FSecondCache Cache;
+
+        const int64 Second = Time.GetTicks() / ETimespan::TicksPerSecond;
+        if (Second != Cache.Second)
+        {
+            Cache.Second = Second;
+            Cache.DateTime = Time.ToFormattedString(TEXT("%d:%m:%Y %H:%M:%S"));
+            Cache.TimeOfDay = Time.ToString(TEXT("%H:%M:%S"));
+        }
+
+        return Cache;
+    }
+}
+
+const FString& FALSTimeFormat::FormatDateTime(const FDateTime& Time)
+{
+    return ALSTimeFormat::GetCache(Time).DateTime;
+}
+
+void FALSTimeFormat::AppendTimeOfDay(const FDateTime& Time, bool bWithMilliseconds, FStringBuilderBase& OutBuilder)
+{
+    OutBuilder.Append(ALSTimeFormat::GetCache(Time).TimeOfDay);
+
+    if (bWithMilliseconds)
+    {
+        OutBuilder.Appendf(TEXT(":%03d"), Time.GetMillisecond());
+    }
+}
@@ -0,0 +1,229 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_Timers.h"
+#include "ALS_FileLog.h"
+#include "ALS_Settings.h"
+#include "ALS_NumberFormat.h"
+#include "Misc/StringBuilder.h"
+
+namespace ALSTimers
+{
+    static const TCHAR* SummaryCaller = TEXT("[ALS Timers]");
+
+    static void AppendMs(FStringBuilderBase& OutBuilder, const TCHAR* Label, double Ms)
+    {
+        OutBuilder.Append(TEXT(" | "));
+        OutBuilder.Append(Label);
+        OutBuilder.AppendChar(TEXT(' '));
+        FALSNumberFormat::AppendFixed(OutBuilder, Ms, 3);
+        OutBuilder.Append(TEXT(" ms"));
+    }
+
+    static double ToMs(uint64 Ns)
+    {
+        return static_cast<double>(Ns) / 1e6;
+    }
+}
+
+FALSTimerHistogram::FALSTimerHistogram(const TCHAR* InName, const FString& InSourceID)
+    : Name(InName)
+    , SourceID(InSourceID)
+{
+    for (std::atomic<uint64>& Bucket : Buckets)
+    {
+        Bucket.store(0, std::memory_order_relaxed);
+    }
+
+    FALSTimers::Register(this);
+}
+
+FALSTimerHistogram::~FALSTimerHistogram()
+{
+    FALSTimers::Unregister(this);
+}
+
+int32 FALSTimerHistogram::GetBucketIndex(uint64 Ns)
+{
+    if (Ns < SubBucketCount)
+    {
+        return static_cast<int32>(Ns);
+    }
+
+    const int32 Exponent = static_cast<int32>(FMath::FloorLog2_64(Ns));
+    if (Exponent > MaxExponent)
+    {
+        return NumBuckets - 1;
+    }
+
+    const int32 SubBucket = static_cast<int32>((Ns >> (Exponent - SubBucketBits)) & (SubBucketCount - 1));
+    return (Exponent - SubBucketBits + 1) * SubBucketCount + SubBucket;
+}
+
+uint64 FALSTimerHistogram::GetBucketLowerBound(int32 BucketIndex)
+{
+    if (BucketIndex < SubBucketCount)
+    {
+        return BucketIndex;
+    }
+
+    const int32 Exponent = BucketIndex / SubBucketCount + SubBucketBits - 1;
+    const uint64 SubBucket = BucketIndex % SubBucketCount;
+    return (SubBucketCount + SubBucket) << (Exponent - SubBucketBits);
+}
+
+void FALSTimerHistogram::AddNs(uint64 Ns)
+{
+    Buckets[GetBucketIndex(Ns)].fetch_add(1, std::memory_order_relaxed);
+    SumNs.fetch_add(Ns, std::memory_order_relaxed);
+
+    uint64 CurrentMin = MinNs.load(std::memory_order_relaxed);
+    while (Ns < CurrentMin && !MinNs.compare_exchange_weak(CurrentMin, Ns, std::memory_order_relaxed)) {}
+
+    uint64 CurrentMax = MaxNs.load(std::memory_order_relaxed);
+    while (Ns > CurrentMax && !MaxNs.compare_exchange_weak(CurrentMax, Ns, std::memory_order_relaxed)) {}
+}
+
+bool FALSTimerHistogram::TakeSummary(FTimerSummaryEntries& OutSummary)
+{
+    // Samples recorded while this runs land in either this summary or the next one, none are lost
+    uint64 Counts[NumBuckets];
+    uint64 Count = 0;
+    for (int32 i = 0; i < NumBuckets; ++i)
+    {
+        Counts[i] = Buckets[i].exchange(0, std::memory_order_relaxed);
+        Count += Counts[i];
+    }
+
+    const uint64 Sum = SumNs.exchange(0, std::memory_order_relaxed);
+    const uint64 Min = MinNs.exchange(MAX_uint64, std::memory_order_relaxed);
+    const uint64 Max = MaxNs.exchange(0, std::memory_order_relaxed);
+
+    if (Count == 0) return false;
+
+    auto GetPercentile = [&](double Percentile) -> uint64
+        {
+            const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(Percentile * Count)));
+
+            uint64 Seen = 0;
+            for (int32 i = 0; i < NumBuckets; ++i)
+            {
+                Seen += Counts[i];
+                if (Seen >= Rank)
+                {
+                    const uint64 Lower = GetBucketLowerBound(i);
+                    const uint64 Upper = i + 1 < NumBuckets ? GetBucketLowerBound(i + 1) : Lower;
+                    return FMath::Clamp(Lower + (Upper - Lower) / 2, FMath::Min(Min, Max), Max);
+                }
+            }
+
+            return Max;
+        };
+
+    OutSummary.Name = Name;
+    OutSummary.Source = SourceID;
+    OutSummary.Count = static_cast<int64>(Count);
+    OutSummary.MinMs = ALSTimers::ToMs(FMath::Min(Min, Max));
+    OutSummary.P50Ms = ALSTimers::ToMs(GetPercentile(0.50));
+    OutSummary.P99Ms = ALSTimers::ToMs(GetPercentile(0.99));
+    OutSummary.MaxMs = ALSTimers::ToMs(Max);
+    OutSummary.MeanMs = ALSTimers::ToMs(Sum / Count);
+    return true;
+}
+
+void FALSTimers::Register(FALSTimerHistogram* Histogram)
+{
+    FScopeLock Lock(&RegistryLock);
+    Histograms.Add(Histogram);
+}
+
+void FALSTimers::Unregister(FALSTimerHistogram* Histogram)
+{
+    FScopeLock Lock(&RegistryLock);
+    Histograms.RemoveSingleSwap(Histogram);
+}
+
+void FALSTimers::StartSummaries()
+{
+    if (SummaryTickerHandle.IsValid()) return;
+
+    const float Interval = FMath::Max(UALS_Settings::Get()->SummaryInterval, 1.0f);
+    SummaryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(TEXT("ALSTimerSummaries"), Interval, [](float DeltaTime)
+        {
+            FlushSummaries();
+            return true;
+        });
+}
+
+void FALSTimers::StopSummaries()
+{
+    if (!SummaryTickerHandle.IsValid()) return;
+
+    FTSTicker::GetCoreTicker().RemoveTicker(SummaryTickerHandle);
+    SummaryTickerHandle.Reset();
+
+    // The last partial interval still makes it into the log
+    FlushSummaries();
+}
+
+void FALSTimers::FlushSummaries()
+{
+    TArray<FTimerSummaryEntries> Summaries;
+    {
+        FScopeLock Lock(&RegistryLock);
+
+        for (FALSTimerHistogram* Histogram : Histograms)
+        {
+            FTimerSummaryEntries Summary;
+            if (Histogram->TakeSummary(Summary))
+            {
+                Summaries.Add(MoveTemp(Summary));
+            }
+        }
+    }
+
+    TStringBuilder<256> Message;
+    for (const FTimerSummaryEntries& Summary : Summaries)
+    {
+        Message.Reset();
+        AppendSummary(Message, Summary);
+        UALS_FileLog::CreateSummaryLog(ALSTimers::SummaryCaller, Summary.Source, Message.ToView());
+    }
+}
+
+void FALSTimers::AppendSummary(FStringBuilderBase& OutBuilder, const FTimerSummaryEntries& Summary)
+{
+    OutBuilder.Append(Summary.Name);
+    OutBuilder.Append(TEXT(" | count "));
+    FALSNumberFormat::AppendInt(OutBuilder, Summary.Count);
+    ALSTimers::AppendMs(OutBuilder, TEXT("min"), Summary.MinMs);
+    ALSTimers::AppendMs(OutBuilder, TEXT("p50"), Summary.P50Ms);
+    ALSTimers::AppendMs(OutBuilder, TEXT("p99"), Summary.P99Ms);
+    ALSTimers::AppendMs(OutBuilder, TEXT("max"), Summary.MaxMs);
+    ALSTimers::AppendMs(OutBuilder, TEXT("mean"), Summary.MeanMs);
+}
+
+bool FALSTimers::ParseSummary(const FString& Message, FTimerSummaryEntries& OutSummary)
+{
+    TArray<FString> Fields;
+    Message.ParseIntoArray(Fields, TEXT(" | "), false);
+    if (Fields.Num() < 7) return false;
+
+    OutSummary.Name = Fields[0];
+
+    for (int32 i = 1; i < Fields.Num(); ++i)
+    {
+        FString Key;
+        FString Value;
+        if (!Fields[i].Split(TEXT(" "), &Key, &Value)) return false;
+
+        const double Number = FCString::Atod(*Value);
+        if (Key == TEXT("count"))     OutSummary.Count = FCString::Atoi64(*Value);
+        else if (Key == TEXT("min"))  OutSummary.MinMs = Number;
+        else if (Key == TEXT("p50"))  OutSummary.P50Ms = Number;
+        else if (Key == TEXT("p99"))  OutSummary.P99Ms = Number;
+        else if (Key == TEXT("max"))  OutSummary.MaxMs = Number;
+        else if (Key == TEXT("mean")) OutSummary.MeanMs = Number;
+    }
+
+    return OutSummary.Count > 0;
+}
@@ -0,0 +1,106 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_Trace.h"
+#include "Misc/ScopeLock.h"
+
+#if ALS_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(ALSChannel)
+
+UE_TRACE_EVENT_BEGIN(ALS, CallSite, NoSync | Important)
+    UE_TRACE_EVENT_FIELD(uint32, Id)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, SourceID)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(ALS, Context, NoSync | Important)
+    UE_TRACE_EVENT_FIELD(uint32, Id)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(ALS, Message)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, CallSiteId)
+    UE_TRACE_EVENT_FIELD(uint32, ContextId)
+    UE_TRACE_EVENT_FIELD(uint8, Severity)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Message)
+UE_TRACE_EVENT_END()
+
+namespace ALSTrace
+{
+    static FCriticalSection KnownIdsLock;
+    static TSet<uint32> KnownCallSites;
+    static TSet<uint32> KnownContexts;
+}
+
+#endif
+
+bool FALSTrace::IsEnabled()
+{
+#if ALS_TRACE_ENABLED
+    return UE_TRACE_CHANNELEXPR_IS_ENABLED(ALSChannel);
+#else
+    return false;
+#endif
+}
+
+void FALSTrace::OutputMessage(const FString& SourceID, const FString& Caller, ELogSeverity LogSeverity, const FString& InMessage)
+{
+#if ALS_TRACE_ENABLED
+    if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(ALSChannel)) return;
+
+    // Resolved first, a new id emits its own event and must not nest inside the message event
+    const uint32 CallSiteId = GetCallSiteId(SourceID);
+    const uint32 ContextId = GetContextId(Caller);
+
+    UE_TRACE_LOG(ALS, Message, ALSChannel)
+        << Message.Cycle(FPlatformTime::Cycles64())
+        << Message.CallSiteId(CallSiteId)
+        << Message.ContextId(ContextId)
+        << Message.Severity(static_cast<uint8>(LogSeverity))
+        << Message.Message(*InMessage, InMessage.Len());
+#endif
+}
+
+uint32 FALSTrace::GetCallSiteId(const FString& SourceID)
+{
+    const uint32 Id = GetTypeHash(SourceID);
+
+#if ALS_TRACE_ENABLED
+    bool bAlreadyKnown = false;
+    {
+        FScopeLock Lock(&ALSTrace::KnownIdsLock);
+        ALSTrace::KnownCallSites.Add(Id, &bAlreadyKnown);
+    }
+
+    if (!bAlreadyKnown)
+    {
+        UE_TRACE_LOG(ALS, CallSite, ALSChannel)
+            << CallSite.Id(Id)
+            << CallSite.SourceID(*SourceID, SourceID.Len());
+    }
+#endif
+
+    return Id;
+}
+
+uint32 FALSTrace::GetContextId(const FString& Caller)
+{
+    const uint32 Id = GetTypeHash(Caller);
+
+#if ALS_TRACE_ENABLED
+    bool bAlreadyKnown = false;
+    {
+        FScopeLock Lock(&ALSTrace::KnownIdsLock);
+        ALSTrace::KnownContexts.Add(Id, &bAlreadyKnown);
+    }
+
+    if (!bAlreadyKnown)
+    {
+        UE_TRACE_LOG(ALS, Context, ALSChannel)
+            << Context.Id(Id)
+            << Context.Name(*Caller, Caller.Len());
+    }
+#endif
+
+    return Id;
+}
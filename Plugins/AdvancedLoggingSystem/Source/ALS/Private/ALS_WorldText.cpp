@@ -0,0 +1,158 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "ALS_WorldText.h"
+#include "ALS_Settings.h"
+#include "ALS_Stats.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "Debug/DebugDrawService.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "SceneInterface.h"
+#include "SceneView.h"
+
+bool UALS_WorldTextSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if !ENABLE_DRAW_DEBUG
+    // DrawDebugString is compiled out in the same builds
+    return false;
+#else
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UALS_WorldTextSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UALS_WorldTextSubsystem::DrawSlots));
+}
+
+void UALS_WorldTextSubsystem::Deinitialize()
+{
+    UDebugDrawService::Unregister(DrawHandle);
+
+    DEC_DWORD_STAT_BY(STAT_ALS_WorldTextSlots, SlotIndices.Num());
+    DEC_MEMORY_STAT_BY(STAT_ALS_WorldTextMemory, Slots.GetAllocatedSize());
+
+    Slots.Reset();
+    FreeSlots.Reset();
+    SlotIndices.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UALS_WorldTextSubsystem::AddText(
+    UWorld* World,
+    const UObject* Target,
+    const UObject* Anchor,
+    const FVector& Location,
+    const FString& SourceID,
+    const FString& Text,
+    float Duration,
+    const FColor& Color)
+{
+    UALS_WorldTextSubsystem* WorldText = World ? World->GetSubsystem<UALS_WorldTextSubsystem>() : nullptr;
+    if (!WorldText) return false;
+
+    FALSWorldTextKey Key{ SourceID, Target };
+
+    int32 SlotIndex = INDEX_NONE;
+    if (const int32* FoundIndex = WorldText->SlotIndices.Find(Key))
+    {
+        SlotIndex = *FoundIndex;
+    }
+    else
+    {
+        const SIZE_T PreviousSize = WorldText->Slots.GetAllocatedSize();
+
+        SlotIndex = WorldText->FreeSlots.Num() > 0 ? WorldText->FreeSlots.Pop() : WorldText->Slots.AddDefaulted();
+        WorldText->SlotIndices.Add(Key, SlotIndex);
+
+        INC_DWORD_STAT(STAT_ALS_WorldTextSlots);
+        INC_MEMORY_STAT_BY(STAT_ALS_WorldTextMemory, WorldText->Slots.GetAllocatedSize() - PreviousSize);
+        WorldText->Slots[SlotIndex].Key = MoveTemp(Key);
+    }
+
+    // Only actors and scene components can be followed, anything else keeps the location it was printed at
+    const bool bCanFollow = Cast<AActor>(Anchor) || Cast<USceneComponent>(Anchor);
+
+    FALSWorldTextSlot& Slot = WorldText->Slots[SlotIndex];
+    Slot.Anchor = bCanFollow ? Anchor : nullptr;
+    Slot.bHasAnchor = bCanFollow;
+    Slot.Location = Location;
+    Slot.Text = Text;
+    Slot.Color = Color;
+    Slot.ExpireTime = FPlatformTime::Seconds() + FMath::Max(Duration, 0.0f);
+    Slot.bDrawn = false;
+    Slot.bInUse = true;
+
+    return true;
+}
+
+void UALS_WorldTextSubsystem::ReleaseSlot(int32 SlotIndex)
+{
+    FALSWorldTextSlot& Slot = Slots[SlotIndex];
+
+    SlotIndices.Remove(Slot.Key);
+    Slot = FALSWorldTextSlot();
+    FreeSlots.Add(SlotIndex);
+
+    DEC_DWORD_STAT(STAT_ALS_WorldTextSlots);
+}
+
+void UALS_WorldTextSubsystem::DrawSlots(UCanvas* Canvas, APlayerController* PlayerController)
+{
+    if (!Canvas || !Canvas->SceneView || !GEngine) return;
+
+    // Every game viewport calls in, only draw into the ones showing this world
+    const FSceneView* View = Canvas->SceneView;
+    const FSceneInterface* Scene = View->Family ? View->Family->Scene : nullptr;
+    if (!Scene || Scene->GetWorld() != GetWorld()) return;
+
+    const double Now = FPlatformTime::Seconds();
+    const FVector ViewOrigin = View->ViewMatrices.GetViewOrigin();
+
+    const float MaxDistance = UALS_Settings::Get()->MaxWorldTextDistance;
+    const double MaxDistanceSquared = MaxDistance > 0.0f ? FMath::Square(static_cast<double>(MaxDistance)) : TNumericLimits<double>::Max();
+
+    UFont* Font = GEngine->GetSmallFont();
+
+    FFontRenderInfo RenderInfo;
+    RenderInfo.bEnableShadow = true;
+
+    // Canvas batches text items sharing the same font, so all slots end up in one draw
+    for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); SlotIndex++)
+    {
+        FALSWorldTextSlot& Slot = Slots[SlotIndex];
+        if (!Slot.bInUse) continue;
+
+        if ((Slot.bDrawn && Slot.ExpireTime <= Now) || (Slot.bHasAnchor && !Slot.Anchor.IsValid()))
+        {
+            ReleaseSlot(SlotIndex);
+            continue;
+        }
+
+        Slot.bDrawn = true;
+
+        FVector WorldLocation = Slot.Location;
+        if (const AActor* Actor = Cast<AActor>(Slot.Anchor.Get()))
+        {
+            WorldLocation += Actor->GetActorLocation();
+        }
+        else if (const USceneComponent* SceneComp = Cast<USceneComponent>(Slot.Anchor.Get()))
+        {
+            WorldLocation += SceneComp->GetComponentLocation();
+        }
+
+        if (FVector::DistSquared(ViewOrigin, WorldLocation) > MaxDistanceSquared) continue;
+        if (!View->ViewFrustum.IntersectPoint(WorldLocation)) continue;
+
+        const FVector ScreenLocation = Canvas->Project(WorldLocation);
+
+        Canvas->SetDrawColor(Slot.Color);
+        Canvas->DrawText(Font, Slot.Text, ScreenLocation.X, ScreenLocation.Y, 1.0f, 1.0f, RenderInfo);
+    }
+}
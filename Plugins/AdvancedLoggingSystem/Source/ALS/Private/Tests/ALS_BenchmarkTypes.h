@@ -0,0 +1,53 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ALS_BenchmarkTypes.generated.h"
+
+// Nested data for the property conversion benchmarks, only used by ALS_Benchmarks.cpp
+
+USTRUCT()
+struct FALSBenchmarkLeaf
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString Name;
+
+    UPROPERTY()
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY()
+    TArray<int32> Values;
+};
+
+USTRUCT()
+struct FALSBenchmarkNode
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FALSBenchmarkLeaf Leaf;
+
+    UPROPERTY()
+    TArray<FALSBenchmarkLeaf> Children;
+
+    UPROPERTY()
+    TMap<FName, FALSBenchmarkLeaf> NamedChildren;
+
+    UPROPERTY()
+    TSet<FString> Tags;
+};
+
+USTRUCT()
+struct FALSBenchmarkRoot
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FALSBenchmarkNode Root;
+
+    UPROPERTY()
+    TArray<FALSBenchmarkNode> Nodes;
+};
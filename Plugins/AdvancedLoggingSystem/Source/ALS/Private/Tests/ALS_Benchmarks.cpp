@@ -0,0 +1,667 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ALS_Globals.h"
+#include "ALS_FileLog.h"
+#include "ALS_LogsUMG.h"
+#include "ALS_NumberFormat.h"
+#include "ALS_Timers.h"
+#include "ALS_Metrics.h"
+#include "ALS_LogTemplates.h"
+#include "ALS_CallSiteStats.h"
+#include "ALS_Macro.h"
+#include "ALS_Settings.h"
+#include "Tests/ALS_BenchmarkTypes.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+// Reaches the viewer's parsing entry point, which is not exposed to Blueprints
+struct FALSBenchmarkAccess
+{
+    static void GetFilteredLogs(UALS_LogsUMG* Widget, const FString& Instance, const FString& SessionID, const FString& Context, FOnGetLogsCompletedNative OnCompleted)
+    {
+        Widget->GetFilteredLogs(false, false, Instance, SessionID, Context, FString(), TEXT("All Levels"), OnCompleted);
+    }
+};
+
+namespace ALSBenchmark
+{
+    static constexpr EAutomationTestFlags::Type TestFlags = EAutomationTestFlags::Type(EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter);
+
+    // A latent step whose callback never fires fails after this long instead of hanging the automation run
+    static constexpr double LatentTimeoutSeconds = 300.0;
+
+    // Forwards to the real allocator and counts allocations made from the benchmark thread. Only installed while allocations are sampled
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        FMalloc* Inner = nullptr;
+        uint32 ThreadId = 0;
+        int64 Allocations = 0;
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { Record(); return Inner->Malloc(Count, Alignment); }
+        virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override { Record(); return Inner->TryMalloc(Count, Alignment); }
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override { if (Count) Record(); return Inner->Realloc(Original, Count, Alignment); }
+        virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override { if (Count) Record(); return Inner->TryRealloc(Original, Count, Alignment); }
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+        virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+        virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+        virtual void UpdateStats() override { Inner->UpdateStats(); }
+        virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+        virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+        virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+    private:
+        void Record()
+        {
+            if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+            {
+                Allocations++;
+            }
+        }
+    };
+
+    struct FScopedAllocationCounter
+    {
+        FScopedAllocationCounter()
+        {
+            Counter.Inner = GMalloc;
+            Counter.ThreadId = FPlatformTLS::GetCurrentThreadId();
+            Counter.Allocations = 0;
+            GMalloc = &Counter;
+        }
+
+        ~FScopedAllocationCounter()
+        {
+            GMalloc = Counter.Inner;
+        }
+
+        int64 GetAllocations() const { return Counter.Allocations; }
+
+        // Outlives any allocation routed through it, blocks are always owned by the inner allocator
+        static inline FCountingMalloc Counter;
+    };
+
+    struct FResult
+    {
+        FString Benchmark;
+        FString Case;
+        int32 Iterations = 0;
+        double TotalSeconds = 0.0;
+
+        // INDEX_NONE when the case runs on worker threads and allocations cannot be attributed
+        int64 Allocations = INDEX_NONE;
+        int32 AllocationSamples = 0;
+    };
+
+    static FString GetPluginVersion()
+    {
+        TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AdvancedLoggingSystem"));
+        return Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("Unknown");
+    }
+
+    // Every run appends to the same CSV, so results of different plugin versions sit side by side
+    static void WriteResult(FAutomationTestBase& Test, const FResult& Result)
+    {
+        const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Automation/ALS/ALS_Benchmarks.csv");
+
+        const double NsPerOp = Result.Iterations > 0 ? Result.TotalSeconds * 1e9 / Result.Iterations : 0.0;
+        const double OpsPerSecond = Result.TotalSeconds > 0.0 ? Result.Iterations / Result.TotalSeconds : 0.0;
+        const FString AllocsPerOp = Result.Allocations == INDEX_NONE || Result.AllocationSamples == 0
+            ? FString()
+            : FString::Printf(TEXT("%.2f"), static_cast<double>(Result.Allocations) / Result.AllocationSamples);
+
+        FString Row;
+        if (!IFileManager::Get().FileExists(*CsvPath))
+        {
+            Row = TEXT("Time,PluginVersion,Benchmark,Case,Iterations,TotalMs,NsPerOp,OpsPerSecond,AllocsPerOp\n");
+        }
+
+        Row += FString::Printf(TEXT("%s,%s,%s,%s,%d,%.3f,%.1f,%.1f,%s\n"),
+            *FDateTime::UtcNow().ToIso8601(),
+            *GetPluginVersion(),
+            *Result.Benchmark,
+            *Result.Case,
+            Result.Iterations,
+            Result.TotalSeconds * 1000.0,
+            NsPerOp,
+            OpsPerSecond,
+            *AllocsPerOp
+        );
+
+        FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+
+        Test.AddInfo(FString::Printf(TEXT("%s [%s]: %.1f ns/op, %s allocs/op"),
+            *Result.Benchmark, *Result.Case, NsPerOp, AllocsPerOp.IsEmpty() ? TEXT("-") : *AllocsPerOp));
+    }
+
+    // Times Iterations calls of Body, then samples its allocations in a separate pass so counting does not skew the timing
+    template <typename FunctionType>
+    static FResult Measure(FAutomationTestBase& Test, const TCHAR* Benchmark, const FString& Case, int32 Iterations, FunctionType&& Body)
+    {
+        for (int32 i = 0; i < FMath::Min(Iterations, 100); i++)
+        {
+            Body();
+        }
+
+        FResult Result;
+        Result.Benchmark = Benchmark;
+        Result.Case = Case;
+        Result.Iterations = Iterations;
+
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; i++)
+        {
+            Body();
+        }
+        Result.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+        Result.AllocationSamples = FMath::Min(Iterations, 1000);
+        {
+            FScopedAllocationCounter Counter;
+            for (int32 i = 0; i < Result.AllocationSamples; i++)
+            {
+                Body();
+            }
+            Result.Allocations = Counter.GetAllocations();
+        }
+
+        WriteResult(Test, Result);
+        return Result;
+    }
+
+    // Fails the test when a case allocates more per call than its budget, a regression the timings alone would hide in the noise
+    static void TestAllocationsPerOp(FAutomationTestBase& Test, const FResult& Result, double MaxAllocationsPerOp)
+    {
+        const double AllocationsPerOp = Result.AllocationSamples > 0 ? static_cast<double>(Result.Allocations) / Result.AllocationSamples : 0.0;
+        Test.TestTrue(FString::Printf(TEXT("%s [%s] allocates %.2f per call, budget %.2f"), *Result.Benchmark, *Result.Case, AllocationsPerOp, MaxAllocationsPerOp),
+            AllocationsPerOp <= MaxAllocationsPerOp);
+    }
+
+    // Keeps benchmark output out of the log while still running through UE_LOG
+    struct FScopedSilenceALS
+    {
+        FScopedSilenceALS() : PreviousVerbosity(LogALS.GetVerbosity()) { LogALS.SetVerbosity(ELogVerbosity::NoLogging); }
+        ~FScopedSilenceALS() { LogALS.SetVerbosity(PreviousVerbosity); }
+
+        ELogVerbosity::Type PreviousVerbosity;
+    };
+
+    // Turns the file log off for the lifetime of the scope, for cases that must not write into the project's log folder
+    struct FScopedDisableFileLog
+    {
+        FScopedDisableFileLog()
+            : Settings(GetMutableDefault<UALS_Settings>())
+            , bPreviousEnableFileLog(Settings->bEnableFileLog)
+        {
+            Settings->bEnableFileLog = false;
+        }
+
+        ~FScopedDisableFileLog()
+        {
+            Settings->bEnableFileLog = bPreviousEnableFileLog;
+        }
+
+        UALS_Settings* Settings;
+        bool bPreviousEnableFileLog;
+    };
+
+    // Points the file log at a scratch folder for the lifetime of the scope
+    struct FScopedLogDirectory
+    {
+        FScopedLogDirectory(const FString& InDirectory)
+            : Settings(GetMutableDefault<UALS_Settings>())
+            , PreviousDirectory(Settings->FileLogRootDir.Path)
+            , bPreviousEnableFileLog(Settings->bEnableFileLog)
+            , Directory(InDirectory)
+        {
+            IFileManager::Get().MakeDirectory(*Directory, true);
+            Settings->FileLogRootDir.Path = Directory;
+            Settings->bEnableFileLog = true;
+        }
+
+        ~FScopedLogDirectory()
+        {
+            UALS_FileLog::CloseLogFiles();
+
+            Settings->FileLogRootDir.Path = PreviousDirectory;
+            Settings->bEnableFileLog = bPreviousEnableFileLog;
+            IFileManager::Get().DeleteDirectory(*Directory, false, true);
+        }
+
+        UALS_Settings* Settings;
+        FString PreviousDirectory;
+        bool bPreviousEnableFileLog;
+        FString Directory;
+    };
+
+    static FString GetScratchDirectory(const TCHAR* Name)
+    {
+        return FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("ALS") / Name);
+    }
+
+    // Writes a log file in the current record format, spread over a few contexts and levels like a real session
+    static bool GenerateLogFile(const FString& FilePath, const FString& SessionID, int32 NumLines, int32 NumContexts)
+    {
+        TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+        if (!Writer.IsValid()) return false;
+
+        static const TCHAR* Levels[] = { TEXT("Info"), TEXT("Warning"), TEXT("Error") };
+        const FALSClockAnchor& Anchor = UALS_FileLog::GetClockAnchor();
+
+        TStringBuilder<1024> Chunk;
+        Chunk.Appendf(TEXT("T%llu-|ALS|-A%lld:%lld:%u-|ALS|-%s-|ALS|-[SESSION CREATED]-|ALS|-[Created a safe Play Session]\n"),
+            Anchor.MonotonicNs, Anchor.UtcTicks, Anchor.LocalOffsetTicks, Anchor.ProcessId, *SessionID);
+
+        for (int32 Line = 0; Line < NumLines; Line++)
+        {
+            Chunk.Appendf(TEXT("T%llu-|ALS|--|ALS|-%s-|ALS|-[BP_Benchmark #%d]-|ALS|-BP_Benchmark:EventGraph:%d-|ALS|-%s-|ALS|-Benchmark message %d with a short payload\n"),
+                Anchor.MonotonicNs + static_cast<uint64>(Line) * 1000,
+                *SessionID,
+                Line % NumContexts,
+                Line % 64,
+                Levels[Line % 3],
+                Line);
+
+            if (Chunk.Len() > 60 * 1024 || Line == NumLines - 1)
+            {
+                FTCHARToUTF8 Converted(Chunk.GetData(), Chunk.Len());
+                Writer->Serialize(const_cast<ANSICHAR*>(Converted.Get()), Converted.Length());
+                Chunk.Reset();
+            }
+        }
+
+        return Writer->Close();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSPrintALSCPPBenchmark, "ALS.Benchmark.PrintALSCPP", ALSBenchmark::TestFlags)
+
+bool FALSPrintALSCPPBenchmark::RunTest(const FString& Parameters)
+{
+    ALSBenchmark::FScopedSilenceALS Silence;
+    ALSBenchmark::FScopedDisableFileLog NoFileLog;
+
+    // Log only, without a context and with the file log off, so this measures formatting and dispatch rather than the screen or the file
+    const FPrintConfig Config(NAME_None, 0.0f, FColor::Green, ELogSeverity::Info, EPrintMode::LogOnly);
+    const FString SourceID = TEXT("ALSBenchmark");
+    const int32 Iterations = 100000;
+
+    const FString Name = TEXT("BP_Benchmark_C_0");
+    const FVector Location(128.5, -64.25, 1024.0);
+    TArray<int32> Values;
+    for (int32 i = 0; i < 16; i++) Values.Add(i * 7);
+    TArray<int32> LargeValues;
+    for (int32 i = 0; i < 1000; i++) LargeValues.Add(i * 7);
+
+    ALSBenchmark::Measure(*this, TEXT("PrintALSCPP"), TEXT("Int"), Iterations, [&]() { UALS_Globals::PrintALSCPP(Config, nullptr, SourceID, 42); });
+    ALSBenchmark::Measure(*this, TEXT("PrintALSCPP"), TEXT("Float"), Iterations, [&]() { UALS_Globals::PrintALSCPP(Config, nullptr, SourceID, 3.14159f); });
+    ALSBenchmark::Measure(*this, TEXT("PrintALSCPP"), TEXT("FString"), Iterations, [&]() { UALS_Globals::PrintALSCPP(Config, nullptr, SourceID, Name); });
+    ALSBenchmark::Measure(*this, TEXT("PrintALSCPP"), TEXT("FVector"), Iterations, [&]() { UALS_Globals::PrintALSCPP(Config, nullptr, SourceID, Location); });
+    ALSBenchmark::Measure(*this, TEXT("PrintALSCPP"), TEXT("TArray<int32>[16]"), Iterations, [&]() { UALS_Globals::PrintALSCPP(Config, nullptr, SourceID, Values); });
+    ALSBenchmark::Measure(*this, TEXT("PrintALSCPP"), TEXT("TArray<int32>[1000]"), Iterations / 100, [&]() { UALS_Globals::PrintALSCPP(Config, nullptr, SourceID, LargeValues); });
+    ALSBenchmark::Measure(*this, TEXT("PrintALSCPP"), TEXT("Mixed"), Iterations, [&]()
+        {
+            UALS_Globals::PrintALSCPP(Config, nullptr, SourceID, TEXT("Actor "), Name, TEXT(" at "), Location, TEXT(" health "), 87.5f, TEXT(" alive "), true);
+        });
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSNumberFormatBenchmark, "ALS.Benchmark.NumberFormat", ALSBenchmark::TestFlags)
+
+bool FALSNumberFormatBenchmark::RunTest(const FString& Parameters)
+{
+    const int32 Iterations = 200000;
+
+    const double Value = -1234.56789;
+    const FVector Location(128.5, -64.25, 1024.0);
+    const FTransform Transform(FRotator(10.0, 45.0, -5.0), Location, FVector(1.0, 2.0, 0.5));
+    const FVector Loc = Transform.GetLocation();
+    const FRotator Rot = Transform.Rotator();
+    const FVector Scale = Transform.GetScale3D();
+
+    // Digit equivalence with printf is checked by ALS.Unit.NumberFormat
+    TStringBuilder<256> Builder;
+
+    ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Printf Int"), Iterations, [&]() { Builder.Reset(); Builder.Appendf(TEXT("%lld"), 1000000007ll); });
+    // The kernel cases format into the builder's inline storage and must not touch the heap
+    ALSBenchmark::TestAllocationsPerOp(*this, ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Kernel Int"), Iterations, [&]() { Builder.Reset(); FALSNumberFormat::AppendInt(Builder, 1000000007ll); }), 0.0);
+
+    ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Printf Float"), Iterations, [&]() { Builder.Reset(); Builder.Appendf(TEXT("%f"), Value); });
+    ALSBenchmark::TestAllocationsPerOp(*this, ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Kernel Float"), Iterations, [&]() { Builder.Reset(); FALSNumberFormat::AppendFixed(Builder, Value); }), 0.0);
+
+    ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Printf FVector"), Iterations, [&]()
+        {
+            Builder.Reset();
+            Builder.Appendf(TEXT("X: %f, Y: %f, Z: %f"), Location.X, Location.Y, Location.Z);
+        });
+    ALSBenchmark::TestAllocationsPerOp(*this, ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Kernel FVector"), Iterations, [&]()
+        {
+            Builder.Reset();
+            UALS_Globals::ConvertToStringCPP(Builder, Location);
+        }), 0.0);
+
+    ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Printf FTransform"), Iterations, [&]()
+        {
+            Builder.Reset();
+            Builder.Appendf(TEXT("[Location] %.3f,%.3f,%.3f -- [Rotation] %.6f,%.6f,%.6f -- [Scale] %.3f,%.3f,%.3f"),
+                Loc.X, Loc.Y, Loc.Z, Rot.Pitch, Rot.Yaw, Rot.Roll, Scale.X, Scale.Y, Scale.Z);
+        });
+    ALSBenchmark::TestAllocationsPerOp(*this, ALSBenchmark::Measure(*this, TEXT("NumberFormat"), TEXT("Kernel FTransform"), Iterations, [&]()
+        {
+            Builder.Reset();
+            UALS_Globals::ConvertToStringCPP(Builder, Transform);
+        }), 0.0);
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSScopeTimerBenchmark, "ALS.Benchmark.ScopeTimer", ALSBenchmark::TestFlags)
+
+bool FALSScopeTimerBenchmark::RunTest(const FString& Parameters)
+{
+    const int32 Iterations = 200000;
+
+    // Bucketing and summaries are checked by ALS.Unit.TimerHistogram
+    FALSTimerHistogram Histogram(TEXT("Benchmark"), TEXT("ALS_Benchmarks.cpp"));
+
+    uint64 Ns = 0;
+    ALSBenchmark::Measure(*this, TEXT("ScopeTimer"), TEXT("AddNs"), Iterations, [&]() { Histogram.AddNs(++Ns); });
+    ALSBenchmark::Measure(*this, TEXT("ScopeTimer"), TEXT("Scope"), Iterations, [&]() { FALSScopeTimer Timer(Histogram); });
+
+    FTimerSummaryEntries Summary;
+    Histogram.TakeSummary(Summary);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSMetricsBenchmark, "ALS.Benchmark.Metrics", ALSBenchmark::TestFlags)
+
+bool FALSMetricsBenchmark::RunTest(const FString& Parameters)
+{
+    const int32 Iterations = 200000;
+
+    // What counting events through log lines costs, against the counter that replaces it
+    TStringBuilder<128> Builder;
+    int32 Spawned = 0;
+    ALSBenchmark::Measure(*this, TEXT("Metrics"), TEXT("Format Spawned String"), Iterations, [&]() { Builder.Reset(); Builder.Appendf(TEXT("Spawned %d"), ++Spawned); });
+    ALSBenchmark::Measure(*this, TEXT("Metrics"), TEXT("ALS_COUNTER_ADD"), Iterations, [&]() { ALS_COUNTER_ADD(BenchmarkCounter, 1); });
+    ALSBenchmark::Measure(*this, TEXT("Metrics"), TEXT("ALS_GAUGE_SET"), Iterations, [&]() { ALS_GAUGE_SET(BenchmarkGauge, ++Spawned); });
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSCallSiteStatsBenchmark, "ALS.Benchmark.CallSiteStats", ALSBenchmark::TestFlags)
+
+bool FALSCallSiteStatsBenchmark::RunTest(const FString& Parameters)
+{
+    const int32 Iterations = 200000;
+    const FString LogFilePath = FPaths::ProjectSavedDir() / TEXT("ALSBenchmark_CallSiteStats.log");
+    const FString SourceID = TEXT("ALS_Benchmarks.cpp:1");
+
+    const int32 CallSite = FALSCallSiteStats::FindOrAddCallSite(LogFilePath, SourceID);
+
+    // Per record cost on the formatting thread and on the writer
+    ALSBenchmark::Measure(*this, TEXT("CallSiteStats"), TEXT("FindOrAddCallSite"), Iterations, [&]() { FALSCallSiteStats::FindOrAddCallSite(LogFilePath, SourceID); });
+    ALSBenchmark::Measure(*this, TEXT("CallSiteStats"), TEXT("AddWritten"), Iterations, [&]() { FALSCallSiteStats::AddWritten(CallSite, 128, UALS_FileLog::GetMonotonicNs()); });
+
+    // Totals and the sidecar round trip are checked by ALS.Unit.CallSiteStats, persisting here only frees the slot
+    FALSCallSiteStats::PersistSidecar(LogFilePath, TEXT("ALSBenchmarkSession"));
+    IFileManager::Get().Delete(*FALSCallSiteStats::GetSidecarPath(LogFilePath));
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSLogTemplatesBenchmark, "ALS.Benchmark.LogTemplates", ALSBenchmark::TestFlags)
+
+bool FALSLogTemplatesBenchmark::RunTest(const FString& Parameters)
+{
+    // Per frame spam of a few shapes, the case batching by exact message can not collapse
+    const FDateTime Now = FDateTime::Now();
+    TArray<FLogEntries> Entries;
+    Entries.Reserve(200000);
+    for (int32 i = 0; i < 200000; i++)
+    {
+        const FString Message = (i % 3 == 0) ? FString::Printf(TEXT("HP: %d"), i % 100)
+            : (i % 3 == 1) ? FString::Printf(TEXT("Spawned Enemy_%d at %d.5 %d.25"), i, i % 1000, -(i % 500))
+            : FString::Printf(TEXT("Request %s took %d ms"), *FGuid::NewGuid().ToString(), i % 40);
+
+        FLogEntries& Entry = Entries.Add_GetRef(FLogEntries(TEXT("Info"), Message, TEXT("ALS_Benchmarks.cpp:1"), Now, i));
+        Entry.Frame = i;
+    }
+
+    TArray<FLogEntries> Templates;
+    ALSBenchmark::Measure(*this, TEXT("LogTemplates"), TEXT("Mine 200000 entries"), 1, [&]() { Templates = FALSLogTemplates::Mine(Entries); });
+
+    for (const FLogEntries& Template : Templates)
+    {
+        AddInfo(FString::Printf(TEXT("%s | %d | %s"), *Template.Message, Template.Count, *Template.ValueRange));
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSConvertPropertyBenchmark, "ALS.Benchmark.ConvertToString_Property", ALSBenchmark::TestFlags)
+
+bool FALSConvertPropertyBenchmark::RunTest(const FString& Parameters)
+{
+    auto MakeLeaf = [](int32 Index)
+        {
+            FALSBenchmarkLeaf Leaf;
+            Leaf.Name = FString::Printf(TEXT("Leaf_%d"), Index);
+            Leaf.Location = FVector(Index, Index * 2.0, Index * 3.0);
+            for (int32 i = 0; i < 16; i++) Leaf.Values.Add(Index + i);
+            return Leaf;
+        };
+
+    auto MakeNode = [&MakeLeaf](int32 Index)
+        {
+            FALSBenchmarkNode Node;
+            Node.Leaf = MakeLeaf(Index);
+            for (int32 i = 0; i < 8; i++)
+            {
+                Node.Children.Add(MakeLeaf(Index * 8 + i));
+                Node.NamedChildren.Add(FName(*FString::Printf(TEXT("Child_%d"), i)), MakeLeaf(i));
+                Node.Tags.Add(FString::Printf(TEXT("Tag_%d"), i));
+            }
+            return Node;
+        };
+
+    FALSBenchmarkRoot Data;
+    Data.Root = MakeNode(0);
+    for (int32 i = 0; i < 16; i++) Data.Nodes.Add(MakeNode(i + 1));
+
+    const UScriptStruct* RootStruct = FALSBenchmarkRoot::StaticStruct();
+    FProperty* RootProperty = RootStruct->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FALSBenchmarkRoot, Root));
+    FProperty* NodesProperty = RootStruct->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FALSBenchmarkRoot, Nodes));
+    FProperty* LeafProperty = FALSBenchmarkNode::StaticStruct()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FALSBenchmarkNode, Leaf));
+
+    if (!TestNotNull(TEXT("Root property"), RootProperty) || !TestNotNull(TEXT("Nodes property"), NodesProperty) || !TestNotNull(TEXT("Leaf property"), LeafProperty))
+    {
+        return false;
+    }
+
+    TStringBuilder<16 * 1024> Builder;
+
+    ALSBenchmark::Measure(*this, TEXT("ConvertToString_Property"), TEXT("Leaf struct"), 100000, [&]()
+        {
+            Builder.Reset();
+            UALS_Globals::ConvertToString_Property(LeafProperty, LeafProperty->ContainerPtrToValuePtr<void>(&Data.Root), Builder);
+        });
+
+    ALSBenchmark::Measure(*this, TEXT("ConvertToString_Property"), TEXT("Nested struct with containers"), 10000, [&]()
+        {
+            Builder.Reset();
+            UALS_Globals::ConvertToString_Property(RootProperty, RootProperty->ContainerPtrToValuePtr<void>(&Data), Builder);
+        });
+
+    ALSBenchmark::Measure(*this, TEXT("ConvertToString_Property"), TEXT("Array of 16 nested structs"), 1000, [&]()
+        {
+            Builder.Reset();
+            UALS_Globals::ConvertToString_Property(NodesProperty, NodesProperty->ContainerPtrToValuePtr<void>(&Data), Builder);
+        });
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSCreateMessageLogBenchmark, "ALS.Benchmark.CreateMessageLog", ALSBenchmark::TestFlags)
+
+bool FALSCreateMessageLogBenchmark::RunTest(const FString& Parameters)
+{
+    ALSBenchmark::FScopedLogDirectory LogDirectory(ALSBenchmark::GetScratchDirectory(TEXT("CreateMessageLog")));
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("ALSBenchmarkWorld"));
+    if (!TestNotNull(TEXT("Benchmark world"), World))
+    {
+        return false;
+    }
+
+    // Without a registered context the instance name is resolved again on every record, which is not what a running game pays
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    const FString SourceID = TEXT("BP_Benchmark:EventGraph:12");
+    const FString ShortMessage = TEXT("Player spawned at checkpoint 3");
+    const FString LongMessage = FString::ChrN(512, TEXT('x'));
+    const FString EscapedMessage = TEXT("Line one\nLine \"two\"\twith 'quotes' and a path C:\\Saved\\Logs");
+
+    // Every iteration logs the same message, which would otherwise only measure the collapse path
+    TGuardValue<bool> CollapseGuard(LogDirectory.Settings->bCollapseRepeatedMessages, false);
+
+    // Steady state records are formatted into thread local buffers and handed to the writer through the ring, none of it may touch the heap
+    ALSBenchmark::TestAllocationsPerOp(*this, ALSBenchmark::Measure(*this, TEXT("CreateMessageLog"), TEXT("Short"), 10000, [&]()
+        {
+            UALS_FileLog::CreateMessageLog(World, SourceID, ShortMessage, ELogSeverity::Info);
+        }), 0.0);
+
+    ALSBenchmark::TestAllocationsPerOp(*this, ALSBenchmark::Measure(*this, TEXT("CreateMessageLog"), TEXT("512 chars"), 10000, [&]()
+        {
+            UALS_FileLog::CreateMessageLog(World, SourceID, LongMessage, ELogSeverity::Warning);
+        }), 0.0);
+
+    ALSBenchmark::TestAllocationsPerOp(*this, ALSBenchmark::Measure(*this, TEXT("CreateMessageLog"), TEXT("Escaped"), 10000, [&]()
+        {
+            UALS_FileLog::CreateMessageLog(World, SourceID, EscapedMessage, ELogSeverity::Error);
+        }), 0.0);
+
+    LogDirectory.Settings->bCollapseRepeatedMessages = true;
+
+    ALSBenchmark::Measure(*this, TEXT("CreateMessageLog"), TEXT("Collapsed repeats"), 10000, [&]()
+        {
+            UALS_FileLog::CreateMessageLog(World, SourceID, ShortMessage, ELogSeverity::Info);
+        });
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSGetFilteredLogsBenchmark, "ALS.Benchmark.GetFilteredLogs", ALSBenchmark::TestFlags)
+
+bool FALSGetFilteredLogsBenchmark::RunTest(const FString& Parameters)
+{
+    // Parsing completes on the game thread a few frames later, so each file size runs as its own latent step
+    TSharedPtr<ALSBenchmark::FScopedLogDirectory> LogDirectory = MakeShared<ALSBenchmark::FScopedLogDirectory>(ALSBenchmark::GetScratchDirectory(TEXT("GetFilteredLogs")));
+    const FString SessionID = TEXT("ALSBenchmarkSession");
+
+    for (const int32 NumLines : { 10000, 100000, 1000000 })
+    {
+        const FString Instance = FString::Printf(TEXT("ALSBenchmark_%d"), NumLines);
+        if (!ALSBenchmark::GenerateLogFile(LogDirectory->Directory / Instance + TEXT(".log"), SessionID, NumLines, 8))
+        {
+            AddError(FString::Printf(TEXT("Unable to generate %s"), *Instance));
+            return false;
+        }
+
+        struct FState
+        {
+            UALS_LogsUMG* Widget = nullptr;
+            double StartTime = 0.0;
+            bool bDone = false;
+        };
+
+        TSharedRef<FState> State = MakeShared<FState>();
+
+        ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State, Instance, SessionID, NumLines]()
+            {
+                if (!State->Widget)
+                {
+                    State->Widget = NewObject<UALS_LogsUMG>(GetTransientPackage());
+                    State->Widget->AddToRoot();
+
+                    FOnGetLogsCompletedNative OnCompleted;
+                    OnCompleted.BindLambda([State](const TArray<FLogEntries>& Entries)
+                        {
+                            State->bDone = true;
+                        });
+
+                    State->StartTime = FPlatformTime::Seconds();
+                    FALSBenchmarkAccess::GetFilteredLogs(State->Widget, Instance, SessionID, TEXT("[BP_Benchmark #0]"), OnCompleted);
+                    return false;
+                }
+
+                if (!State->bDone)
+                {
+                    if (FPlatformTime::Seconds() - State->StartTime < ALSBenchmark::LatentTimeoutSeconds) return false;
+
+                    AddError(FString::Printf(TEXT("GetFilteredLogs did not complete for %s within %.0f seconds"), *Instance, ALSBenchmark::LatentTimeoutSeconds));
+                    State->Widget->RemoveFromRoot();
+                    return true;
+                }
+
+                ALSBenchmark::FResult Result;
+                Result.Benchmark = TEXT("GetFilteredLogs");
+                Result.Case = FString::Printf(TEXT("%d lines"), NumLines);
+                Result.Iterations = 1;
+                Result.TotalSeconds = FPlatformTime::Seconds() - State->StartTime;
+                ALSBenchmark::WriteResult(*this, Result);
+
+                State->Widget->RemoveFromRoot();
+                return true;
+            }));
+    }
+
+    ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([LogDirectory]() mutable
+        {
+            // Drops the last reference, which restores the settings and removes the generated files
+            LogDirectory.Reset();
+            return true;
+        }));
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,166 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ALS_Definitions.h"
+#include "ALS_NumberFormat.h"
+#include "ALS_Timers.h"
+#include "ALS_Metrics.h"
+#include "ALS_LogTemplates.h"
+#include "ALS_CallSiteStats.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+// Correctness checks of the pieces the benchmarks time, fast enough to run with every product test pass
+namespace ALSTests
+{
+    static constexpr EAutomationTestFlags::Type TestFlags = EAutomationTestFlags::Type(EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSNumberFormatTest, "ALS.Unit.NumberFormat", ALSTests::TestFlags)
+
+bool FALSNumberFormatTest::RunTest(const FString& Parameters)
+{
+    TStringBuilder<256> Builder;
+
+    // The kernel must produce the same digits as printf for the precisions ALS uses
+    // The last group scales into [2^52, 2^53) at one of the precisions, where the fixed point path has to hand over to printf
+    for (const double Sample : { 0.0, -0.0, 0.5, 1.005, -1234.56789, 3.14159265358979, 1e-7, -1e-7, 999999.9999995, 123456789012.345,
+        5395814387.4463701, -4503599627.3704965, 6000000000000.125, 50000000000000.07, 4503599627370497.5, 8999999999999999.0 })
+    {
+        for (int32 Precision : { 0, 2, 3, 6 })
+        {
+            Builder.Reset();
+            FALSNumberFormat::AppendFixed(Builder, Sample, Precision);
+            TestEqual(FString::Printf(TEXT("AppendFixed(%.17g, %d)"), Sample, Precision), FString(Builder.ToView()), FString::Printf(TEXT("%.*f"), Precision, Sample));
+        }
+    }
+
+    for (const int64 Sample : { int64(0), int64(7), int64(-42), int64(1000000007), MIN_int64, MAX_int64 })
+    {
+        Builder.Reset();
+        FALSNumberFormat::AppendInt(Builder, Sample);
+        TestEqual(FString::Printf(TEXT("AppendInt(%lld)"), Sample), FString(Builder.ToView()), FString::Printf(TEXT("%lld"), Sample));
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSTimerHistogramTest, "ALS.Unit.TimerHistogram", ALSTests::TestFlags)
+
+bool FALSTimerHistogramTest::RunTest(const FString& Parameters)
+{
+    // Every value must land in a bucket whose bounds contain it
+    for (const uint64 Sample : { 0ull, 7ull, 8ull, 15ull, 16ull, 1000ull, 123456789ull, 1ull << 42 })
+    {
+        const int32 Index = FALSTimerHistogram::GetBucketIndex(Sample);
+        const uint64 Lower = FALSTimerHistogram::GetBucketLowerBound(Index);
+        const uint64 Upper = FALSTimerHistogram::GetBucketLowerBound(Index + 1);
+        TestTrue(FString::Printf(TEXT("Bucket of %llu"), Sample), Lower <= Sample && (Sample < Upper || Index == FALSTimerHistogram::NumBuckets - 1));
+    }
+
+    FALSTimerHistogram Histogram(TEXT("UnitTest"), TEXT("ALS_Tests.cpp"));
+    for (uint64 Ns = 1; Ns <= 1000; ++Ns)
+    {
+        Histogram.AddNs(Ns * 1000);
+    }
+
+    FTimerSummaryEntries Summary;
+    TestTrue(TEXT("TakeSummary"), Histogram.TakeSummary(Summary));
+    TestEqual(TEXT("Count"), Summary.Count, int64(1000));
+    TestTrue(TEXT("P50 within a bucket"), FMath::IsNearlyEqual(Summary.P50Ms, 0.5, 0.5 / 16.0));
+    TestTrue(TEXT("P99 within a bucket"), FMath::IsNearlyEqual(Summary.P99Ms, 0.99, 0.99 / 16.0));
+    TestEqual(TEXT("Max"), Summary.MaxMs, 1.0);
+    TestFalse(TEXT("Reset after TakeSummary"), Histogram.TakeSummary(Summary));
+
+    TStringBuilder<256> Builder;
+    FALSTimers::AppendSummary(Builder, Summary);
+    FTimerSummaryEntries Parsed;
+    TestTrue(TEXT("ParseSummary"), FALSTimers::ParseSummary(FString(Builder.ToView()), Parsed) && Parsed.Count == Summary.Count);
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSMetricsTest, "ALS.Unit.Metrics", ALSTests::TestFlags)
+
+bool FALSMetricsTest::RunTest(const FString& Parameters)
+{
+    TestEqual(TEXT("Same name, same id"), FALSMetrics::RegisterMetric(TEXT("UnitTestCounter"), EALSMetricType::Counter), FALSMetrics::RegisterMetric(TEXT("UnitTestCounter"), EALSMetricType::Counter));
+
+    TArray<FALSMetricSample> Samples;
+    TestTrue(TEXT("ParseSummary"), FALSMetrics::ParseSummary(TEXT("counter Spawned 120 | gauge Alive 37.500"), Samples));
+    TestTrue(TEXT("Parsed samples"), Samples.Num() == 2 && Samples[0].Value == 120.0 && Samples[1].Type == EALSMetricType::Gauge && Samples[1].Value == 37.5);
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSCallSiteStatsTest, "ALS.Unit.CallSiteStats", ALSTests::TestFlags)
+
+bool FALSCallSiteStatsTest::RunTest(const FString& Parameters)
+{
+    const FString LogFilePath = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("ALS/ALSUnitTest_CallSiteStats.log"));
+    const FString SourceID = TEXT("ALS_Tests.cpp:1");
+
+    const int32 CallSite = FALSCallSiteStats::FindOrAddCallSite(LogFilePath, SourceID);
+    TestEqual(TEXT("Same file and source, same slot"), FALSCallSiteStats::FindOrAddCallSite(LogFilePath, SourceID), CallSite);
+
+    for (int32 i = 0; i < 10; i++)
+    {
+        FALSCallSiteStats::AddWritten(CallSite, 128, 1000 + i);
+    }
+
+    TArray<FALSCallSiteSample> Samples;
+    FALSCallSiteStats::GetCallSites(&LogFilePath, Samples);
+    TestTrue(TEXT("Live totals"), Samples.Num() == 1 && Samples[0].SourceID == SourceID && Samples[0].Messages == 10 && Samples[0].Bytes == 1280);
+
+    // The same lookup the top talkers panel does, without the log file
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(LogFilePath), true);
+    TestTrue(TEXT("PersistSidecar"), FALSCallSiteStats::PersistSidecar(LogFilePath, TEXT("ALSUnitTestSession")));
+    TestTrue(TEXT("LoadSidecar"), FALSCallSiteStats::LoadSidecar(LogFilePath, TEXT("ALSUnitTestSession"), Samples) && Samples.Num() == 1 && Samples[0].Messages == 10);
+    IFileManager::Get().Delete(*FALSCallSiteStats::GetSidecarPath(LogFilePath));
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSLogTemplatesTest, "ALS.Unit.LogTemplates", ALSTests::TestFlags)
+
+bool FALSLogTemplatesTest::RunTest(const FString& Parameters)
+{
+    FString Masked;
+    double Value;
+    TestTrue(TEXT("MaskToken number"), FALSLogTemplates::MaskToken(TEXT("Enemy_42"), Masked, Value) && Masked == TEXT("Enemy_<*>") && Value == 42.0);
+    TestTrue(TEXT("MaskToken guid"), FALSLogTemplates::MaskToken(FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens), Masked, Value) && Masked == FALSLogTemplates::Wildcard);
+    TestFalse(TEXT("MaskToken word"), FALSLogTemplates::MaskToken(TEXT("Health:"), Masked, Value));
+
+    // Three shapes with varying numbers and ids must mine into three templates
+    const FDateTime Now = FDateTime::Now();
+    TArray<FLogEntries> Entries;
+    for (int32 i = 0; i < 300; i++)
+    {
+        const FString Message = (i % 3 == 0) ? FString::Printf(TEXT("HP: %d"), i % 100)
+            : (i % 3 == 1) ? FString::Printf(TEXT("Spawned Enemy_%d at %d.5 %d.25"), i, i % 1000, -(i % 500))
+            : FString::Printf(TEXT("Request %s took %d ms"), *FGuid::NewGuid().ToString(), i % 40);
+
+        FLogEntries& Entry = Entries.Add_GetRef(FLogEntries(TEXT("Info"), Message, TEXT("ALS_Tests.cpp:1"), Now, i));
+        Entry.Frame = i;
+    }
+
+    TestEqual(TEXT("Templates"), FALSLogTemplates::Mine(Entries).Num(), 3);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Totals of one call site in one instance file
+struct FALSCallSiteSample
+{
+    FString SourceID;
+    uint64 Messages = 0;
+    uint64 Bytes = 0;
+    uint64 Suppressed = 0;
+    int64 LastSeenUnixNs = 0;
+};
+
+/**
+ * Always-on counters per call site and instance file: records written, bytes written, repeats collapsed and the last time it logged.
+ * Slots live in a fixed open addressed table, claimed once per call site, after that every update is a relaxed atomic add.
+ * The writer persists a file's totals into "<Instance>.callsites" next to the log when the file closes and frees its slots,
+ * so instances that come and go over a long run do not use the table up.
+ */
+class ALS_API FALSCallSiteStats
+{
+public:
+    static constexpr int32 MaxCallSites = 2048;
+    static constexpr const TCHAR* SidecarExtension = TEXT(".callsites");
+
+    // Same file and source returns the same slot from any thread. INDEX_NONE once MaxCallSites slots are taken
+    static int32 FindOrAddCallSite(const FString& LogFilePath, FStringView SourceID);
+
+    // Called by the writer for every record that reached the file
+    static void AddWritten(int32 CallSite, uint64 Bytes, uint64 TimestampNs);
+
+    // Called for every repeat folded into a trailer record instead of being written
+    static void AddSuppressed(int32 CallSite, uint64 TimestampNs);
+
+    // Live totals of one file, or of every file when LogFilePath is null. Most messages first
+    static void GetCallSites(const FString* LogFilePath, TArray<FALSCallSiteSample>& OutSamples);
+
+    // Appends the file's totals as lines of SessionID to the sidecar and frees the file's slots
+    static bool PersistSidecar(const FString& LogFilePath, const FString& SessionID);
+
+    // Totals of one session from the sidecar, summed per call site. Most messages first
+    static bool LoadSidecar(const FString& LogFilePath, const FString& SessionID, TArray<FALSCallSiteSample>& OutSamples);
+
+    static FString GetSidecarPath(const FString& LogFilePath);
+
+    // Writes the busiest call sites of every open file to the output log, the "alstoptalkers [N]" console command
+    static void DumpTopTalkers(int32 NumTop);
+
+    // Adds the totals of Samples into OutSamples by source and sorts the result, most messages first
+    static void MergeSamples(const TArray<FALSCallSiteSample>& Samples, TArray<FALSCallSiteSample>& OutSamples);
+
+private:
+    // Slot keys below FirstKey are states, not hashes
+    static constexpr uint64 EmptyKey = 0;
+    static constexpr uint64 TombstoneKey = 1;
+    static constexpr uint64 FirstKey = 2;
+
+    struct FSlot
+    {
+        // Hash of file and source, published once the slot is filled in. EmptyKey until first claimed, TombstoneKey once freed
+        std::atomic<uint64> Key = EmptyKey;
+
+        // Guarded by SlotsLock
+        FString LogFilePath;
+        FString SourceID;
+
+        std::atomic<uint64> Messages = 0;
+        std::atomic<uint64> Bytes = 0;
+        std::atomic<uint64> Suppressed = 0;
+        std::atomic<uint64> LastSeenNs = 0;
+    };
+
+    static inline FSlot Slots[MaxCallSites];
+
+    // Taken to claim, read or free a slot, never by the counter updates
+    static inline FCriticalSection SlotsLock;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
+#include "ALS_TimeFormat.h"
 #include "ALS_Definitions.generated.h"
 
 inline FLogCategory<ELogVerbosity::Log, ELogVerbosity::All> LogALS(TEXT("LogALS"));
@@ -69,19 +70,25 @@ struct FPrintConfig
     // Print output type: screen only, log only, or both
     UPROPERTY(EditDefaultsOnly, meta = (DisplayName = "Print Mode", Category = "ALS Config"))
     EPrintMode PrintMode;
+
+    // Decimal places for floats, vectors, rotators and other floating point values, including structs printed through reflection
+    UPROPERTY(EditDefaultsOnly, meta = (DisplayName = "Float Precision", Category = "ALS Config", ClampMin = "0", ClampMax = "9"))
+    int32 FloatPrecision;
  
     FPrintConfig(
         FName InKey = NAME_None,
         float InDuration = 5.0f,
         FColor InColor = FColor::Green,
         ELogSeverity InLogSeverity = ELogSeverity::Info, 
-        EPrintMode InPrintMode = EPrintMode::ScreenAndLog
+        EPrintMode InPrintMode = EPrintMode::ScreenAndLog,
+        int32 InFloatPrecision = 6
     ) 
         : Color(InColor)
         , Duration(InDuration)
         , Key(InKey)
         , LogSeverity(InLogSeverity)
         , PrintMode(InPrintMode) 
+        , FloatPrecision(InFloatPrecision)
     {}
 };
 
@@ -105,6 +112,12 @@ struct FLogEntries
     UPROPERTY(BlueprintReadOnly, Category = "ALS LogEntries")
     FString PeriodMessage;
 
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogEntries")
+    FString Instance;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogEntries")
+    FString Context;
+
     UPROPERTY()
     FDateTime StartTime;
 
@@ -114,8 +127,17 @@ struct FLogEntries
     UPROPERTY()
     int32 Count;
 
+    // Nanoseconds since the Unix epoch (UTC), comparable across instances
     UPROPERTY()
-    uint64 CycleCounter;
+    int64 Timestamp;
+
+    // GFrameCounter of the record, the first one for batched entries. INDEX_NONE when the record has no frame tag
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogEntries")
+    int64 Frame;
+
+    // Template entries only, the numeric range behind each <*> of the message such as "#1: 12 .. 93"
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogEntries")
+    FString ValueRange;
 
     FLogEntries()
         : DateTime()
@@ -125,7 +147,8 @@ struct FLogEntries
         , StartTime(FDateTime::MinValue())
         , EndTime(FDateTime::MinValue())
         , Count(0)
-        , CycleCounter(0)
+        , Timestamp(0)
+        , Frame(INDEX_NONE)
     {}
 
     FLogEntries(
@@ -133,18 +156,24 @@ struct FLogEntries
         const FString& InMessage,
         const FString& InSource,
         const FDateTime& InitialTime,
-        uint64 InCycleCounter
+        int64 InTimestamp
     )
-        : DateTime(InitialTime.ToFormattedString(TEXT("%d:%m:%Y %H:%M:%S")))
+        : DateTime(FALSTimeFormat::FormatDateTime(InitialTime))
         , Level(InLevel)
         , Message(InMessage)
         , Source(InSource)
-        , PeriodMessage(FString::Printf(TEXT("(1 time logged on %s)"), *InitialTime.ToString(TEXT("%H:%M:%S:%s"))))
         , StartTime(InitialTime)
         , EndTime(InitialTime)
         , Count(1)
-        , CycleCounter(InCycleCounter)
-    {}
+        , Timestamp(InTimestamp)
+        , Frame(INDEX_NONE)
+    {
+        TStringBuilder<64> Period;
+        Period.Append(TEXT("(1 time logged on "));
+        FALSTimeFormat::AppendTimeOfDay(InitialTime, true, Period);
+        Period.Append(TEXT(")"));
+        PeriodMessage = Period.ToString();
+    }
 };
 
 USTRUCT(BlueprintType, meta = (Category = "AdvancedLoggingSystem"))
@@ -173,3 +202,119 @@ struct FContextEntries
         , NetworkText(InNetwork)
 	{}
 };
+
+// One interval of one ALS_SCOPE_TIMER / ALS_TIMER_BEGIN call site, a row of the Logs Viewer's timer table
+USTRUCT(BlueprintType, meta = (Category = "AdvancedLoggingSystem"))
+struct FTimerSummaryEntries
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    FString Name;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    FString Source;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    FString DateTime;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    int64 Count = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    double MinMs = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    double P50Ms = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    double P99Ms = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    double MaxMs = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS TimerEntries")
+    double MeanMs = 0.0;
+
+    // Nanoseconds since the Unix epoch (UTC) of the summary record
+    UPROPERTY()
+    int64 Timestamp = 0;
+};
+
+// One frame of a session in the Logs Viewer's group by frame mode
+USTRUCT(BlueprintType, meta = (Category = "AdvancedLoggingSystem"))
+struct FFrameEntries
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS FrameEntries")
+    int64 Frame = INDEX_NONE;
+
+    // Time of the frame's first record
+    UPROPERTY(BlueprintReadOnly, Category = "ALS FrameEntries")
+    FString DateTime;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS FrameEntries")
+    int32 NumRecords = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS FrameEntries")
+    int32 NumWarnings = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS FrameEntries")
+    int32 NumErrors = 0;
+};
+
+// Every recorded value of one ALS_COUNTER_ADD / ALS_GAUGE_SET metric in a session, ready to plot
+USTRUCT(BlueprintType, meta = (Category = "AdvancedLoggingSystem"))
+struct FMetricSeriesEntries
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS MetricEntries")
+    FString Name;
+
+    // "Counter" values are per interval deltas, "Gauge" values are the last value set
+    UPROPERTY(BlueprintReadOnly, Category = "ALS MetricEntries")
+    FString Type;
+
+    // Seconds since the session's first metrics record, one per value
+    UPROPERTY(BlueprintReadOnly, Category = "ALS MetricEntries")
+    TArray<double> Seconds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS MetricEntries")
+    TArray<double> Values;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS MetricEntries")
+    double MinValue = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS MetricEntries")
+    double MaxValue = 0.0;
+
+    // Sum of all counter deltas, the last value for gauges
+    UPROPERTY(BlueprintReadOnly, Category = "ALS MetricEntries")
+    double Total = 0.0;
+};
+
+// One call site in the Logs Viewer's top talkers panel
+USTRUCT(BlueprintType, meta = (Category = "AdvancedLoggingSystem"))
+struct FCallSiteEntries
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS CallSiteEntries")
+    FString Source;
+
+    // Records written to the file, a collapsed run counts as one
+    UPROPERTY(BlueprintReadOnly, Category = "ALS CallSiteEntries")
+    int64 Messages = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS CallSiteEntries")
+    int64 Bytes = 0;
+
+    // Repeats folded into a trailer record instead of being written
+    UPROPERTY(BlueprintReadOnly, Category = "ALS CallSiteEntries")
+    int64 Suppressed = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS CallSiteEntries")
+    FString LastSeen;
+};
@@ -32,6 +32,18 @@ protected:
 
     UPROPERTY(BlueprintReadOnly, Category = "ALS LogsMessageObject")
     FString Level;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogsMessageObject")
+    FText Instance;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogsMessageObject")
+    FText Context;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogsMessageObject")
+    int64 Frame = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ALS LogsMessageObject")
+    FText ValueRange;
 };
 
 
@@ -8,17 +8,224 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/App.h"
+#include "Tasks/Task.h"
+#include "HAL/Thread.h"
+#include <atomic>
+
+// Maps the monotonic nanosecond clock of one process to wall-clock time. Written once per session into every instance file
+struct ALS_API FALSClockAnchor
+{
+    uint64 MonotonicNs = 0;
+    int64 UtcTicks = 0;
+    int64 LocalOffsetTicks = 0;
+    uint32 ProcessId = 0;
+
+    int64 ToUnixNs(uint64 InMonotonicNs) const;
+    FDateTime ToLocalTime(uint64 InMonotonicNs) const;
+};
+
+// Everything the file log derives from a world, rebuilt only when the world goes away or its net mode changes
+struct FALSWorldLogState
+{
+    ENetMode NetMode = NM_MAX;
+    FString InstanceName;
+    FString LogFilePath;
+    int32 FileId = INDEX_NONE;
+    bool bWritable = false;
+};
+
+enum class EALSRingRecordKind : uint8
+{
+    Record,
+
+    // Clock anchor of the session, repeated at the top of every later segment of the file
+    Anchor,
+
+    // Carries the session instead of a record and releases the file once the records before it are written
+    CloseFile
+};
+
+// Header of one record in a record ring, followed by NumBytes of UTF-8
+struct FALSRingRecord
+{
+    uint64 TimestampNs = 0;
+    int32 FileId = INDEX_NONE;
+
+    // FALSCallSiteStats slot the writer counts the record against, INDEX_NONE for anchors
+    int32 CallSite = INDEX_NONE;
+    int32 NumBytes = 0;
+    EALSRingRecordKind Kind = EALSRingRecordKind::Record;
+};
+
+// Formatted records of one thread. Only that thread produces and only the holder of the writer lock consumes, so neither side locks per record
+struct FALSRecordRing
+{
+    static constexpr uint64 Capacity = 256 * 1024;
+
+    // Byte counters that only grow, the ring offset is the counter modulo Capacity
+    std::atomic<uint64> Head = 0;
+    std::atomic<uint64> Tail = 0;
+
+    // Set when the producing thread exits, the writer frees the ring once it is drained
+    std::atomic<bool> bRetired = false;
+
+    uint8 Data[Capacity];
+};
+
+// Identical records from one call site held back by the writer, written as a single trailer record when the run ends
+struct FALSRepeatRun
+{
+    int32 FileId = INDEX_NONE;
+    FString CallerName;
+    FString SourceID;
+    FString Level;
+    FString Message;
+    uint64 MessageHash = 0;
+    uint64 FirstNs = 0;
+    uint64 LastNs = 0;
+    uint64 LastFrame = 0;
+    int32 Repeats = 0;
+    int32 CallSite = INDEX_NONE;
+
+    // Thread of the first record, 0 on the game thread
+    uint32 ThreadId = 0;
+};
+
+// Open append handle of one instance, which writes to the current segment of its logical log
+struct FALSLogFileWriter
+{
+    TUniquePtr<FArchive> Archive;
+    int32 SegmentIndex = 0;
+    double OpenedTime = 0.0;
+
+    // Last anchor record written to the file, so a new segment can be read on its own
+    TArray<uint8> AnchorRecord;
+};
 
 class ALS_API UALS_FileLog
 {
 private:
     static inline FString CurrentSessionTime = TEXT("");
 
+    // Bumped whenever the session changes. Formatting threads keep their own copy of the session string per generation
+    static inline std::atomic<uint32> SessionGeneration = 1;
+
+    // Guards the world states and session bookkeeping. Only held to resolve a file, never while a record is formatted
+    static inline FCriticalSection WorldLogLock;
+
+    static inline TMap<TWeakObjectPtr<const UWorld>, FALSWorldLogState> WorldLogStates;
+
+    // Instance file for records without a world context, the most recently resolved game world
+    static inline std::atomic<int32> ThreadLogFileId = INDEX_NONE;
+
+    // Every log file gets a stable id the first time it is resolved. Ids are never reused, a path is written once before NumLogFiles publishes it
+    static constexpr int32 MaxLogFiles = 256;
+    static inline FString LogFilePaths[MaxLogFiles];
+    static inline std::atomic<int32> NumLogFiles = 0;
+    static inline FCriticalSection LogFileIdLock;
+
+    // SessionGeneration in which each file got its clock anchor, files of an older generation are anchored again
+    static inline std::atomic<uint32> AnchoredGenerations[MaxLogFiles];
+
+    // Guards the open writers and consumes the record rings. Taken after WorldLogLock when both are needed
+    static inline FCriticalSection WriterLock;
+
+    // One append handle per instance file, kept open for the lifetime of the worlds writing to it. Keyed by the file id of the base log, not the segment
+    static inline TMap<int32, FALSLogFileWriter> LogFileWriters;
+
+    // Current run of every call site, keyed by file, caller and source. Sharded by key so threads logging from different call sites do not contend
+    static constexpr int32 NumRepeatShards = 32;
+    struct FRepeatShard
+    {
+        FCriticalSection Lock;
+        TMap<uint64, FALSRepeatRun> Runs;
+    };
+    static inline FRepeatShard RepeatShards[NumRepeatShards];
+
+    // Records are formatted on the calling thread into its ring and written by one writer thread, woken through WriterEvent
+    static inline FCriticalSection RingsLock;
+    static inline TArray<FALSRecordRing*> RecordRings;
+    static inline std::atomic<bool> bWriteScheduled = false;
+    static inline std::atomic<FEvent*> WriterEvent = nullptr;
+    static inline std::atomic<bool> bStopWriter = false;
+    static inline FThread WriterThread;
+
+    static const FALSWorldLogState& FindOrAddWorldState(const UWorld* World);
+
+    static void ReleaseLogFileWriter(int32 FileId);
+
+    static bool BuildInstanceName(const UWorld* World, FString& OutInstanceName);
+
     static void InitializeSessionTime();
 
-    static FString GetSessionTime();
+    static const FString& GetSessionTime();
+
+    // Session string of the calling thread, refreshed under WorldLogLock only when the session changed
+    static const FString& GetThreadSessionTime();
+
+    static int32 FindOrAddLogFileId(const FString& LogFilePath);
+
+    // INDEX_NONE when the file was never written in this run
+    static int32 FindLogFileId(const FString& LogFilePath);
+
+    static const FString& GetLogFilePath(int32 FileId);
+
+    static bool IsAnchored(int32 FileId);
+
+    static void AppendEscapedForLog(FStringBuilderBase& OutBuilder, FStringView InText);
+
+    static bool WriteMessageRecord(const UObject* Context, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message);
+
+    // The meta column is "f<Frame>" plus ";"-separated tags. Meta replaces the thread tag when set
+    static bool WriteMessageRecord(int32 FileId, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, FStringView Meta = FStringView());
+
+    static bool WriteFormattedRecord(int32 FileId, FStringView SessionID, uint64 TimestampNs, uint64 Frame, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, FStringView Meta);
+
+    // True when the record repeats its call site's previous one and was folded into the run instead of written
+    static bool CollapseRepeat(int32 FileId, FStringView SessionID, FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, uint64 TimestampNs);
+
+    // Writes the trailer of every run with repeats, of one file or all when FileId is INDEX_NONE
+    static void EndRepeatRuns(int32 FileId);
+
+    // Writes the trailer of every run past the flush interval or repeat limit. The run stays in its shard, its next message starts a new one
+    static void EndStaleRepeatRuns();
+
+    // The trailer is stamped with the time it is written so the file stays in time order, the run's own span is in its "r<Repeats>:<FirstNs>:<LastNs>" tag
+    static bool WriteRepeatTrailer(const FALSRepeatRun& Run, FStringView SessionID, uint64 TimestampNs);
+
+    static bool WriteThreadRecord(FStringView CallerName, FStringView SourceID, FStringView Level, FStringView Message, FStringView Meta);
+
+    static bool WriteAnchorRecord(int32 FileId);
+
+    // Copies a complete record into the calling thread's ring for the background writer
+    static bool WriteRecord(int32 FileId, const FStringBuilderBase& Record, int32 CallSite = INDEX_NONE, uint64 TimestampNs = 0, EALSRingRecordKind Kind = EALSRingRecordKind::Record);
+
+    static FALSRecordRing& GetRecordRing();
+
+    // Wakes the writer thread unless it is already woken. Before startup and after shutdown the caller drains the rings itself
+    static void ScheduleWrite();
+
+    // Also woken once per tick to end stale repeat runs when nothing is logged
+    static constexpr uint32 WriterTickMs = 1000;
 
-    static FString EscapeForLog(const FString& InText);
+    static void RunWriter(FEvent* Event);
+
+    // Writes everything published so far, merged across rings by timestamp. Runs on the writer thread, or on the caller when the log files are flushed
+    static void DrainPendingRecords();
+
+    // Data and WrappedData are the two halves of a record that wraps around the end of its ring
+    static bool WritePendingRecord(const FALSRingRecord& Record, const uint8* Data, int32 NumData, const uint8* WrappedData, int32 NumWrapped, TSet<int32>& OutTouchedFiles);
+
+    static bool OpenLogFileWriter(const FString& LogFilePath, FALSLogFileWriter& FileWriter, int32 SegmentIndex);
+
+    // Moves the writer to the next segment once the current one is over the size or age limit
+    static bool RollOverIfNeeded(const FString& LogFilePath, FALSLogFileWriter& FileWriter);
+
+    static inline UE::Tasks::FTask RotationTask;
+    static inline std::atomic<bool> bCancelRotation = false;
+
+    // Pause after each rotated instance and each compressed block, about 2 ms per 256 KB
+    static constexpr float RotationThrottleSeconds = 0.002f;
 
     static FString UnEscapeForWidget(const FString& InText);
 
@@ -40,11 +247,49 @@ public:
         const ELogSeverity& LogSeverity
     );
 
+    // Thread-safe and without a UObject. Goes to the instance file of the most recent game world, or "<Project>_Background" when there is none
+    static bool CreateThreadMessageLog(FStringView CallerName, FStringView SourceID, ELogSeverity LogSeverity, FStringView Message);
+
+    // Meta column of aggregate records such as timer summaries, the Logs Viewer lists them apart from messages
+    static constexpr const TCHAR* SummaryMeta = TEXT("S");
+
+    // Same destination as CreateThreadMessageLog, tagged with SummaryMeta
+    static bool CreateSummaryLog(FStringView CallerName, FStringView SourceID, FStringView Message);
+
     static bool CreateSessionLog(const UWorld* World);
 
     static void RotateOlderLogs();
 
+    // Runs RotateOlderLogs on a low priority background task
+    static void RotateOlderLogsAsync();
+
+    // Stops a running rotation at the next file or compressed block and waits for it
+    static void WaitForRotation();
+
+    // Owned by the module, the writer thread lives from startup to shutdown
+    static void StartWriter();
+    static void StopWriter();
+
+    static void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+    // Blocks until every queued record is on disk. Runs still being collapsed stay open
+    static void FlushLogFiles();
+
+    // Copies the runs of a file that have repeats but no trailer yet, so a viewer can show their counts so far
+    static void GetOpenRepeatRuns(const FString& LogFilePath, TArray<FALSRepeatRun>& OutRuns);
+
+    static void CloseLogFiles();
+
     static FString GetCurrentInstance(const UWorld* World);
 
+    // Session of the records written from now on
+    static FString GetCurrentSessionID();
+
+    static const TCHAR* GetSeverityName(ELogSeverity LogSeverity);
+
     static bool IsFileBigger(const FString& LogFilePath, int32& OutFileSize);
+
+    static uint64 GetMonotonicNs();
+
+    static const FALSClockAnchor& GetClockAnchor();
 };
@@ -8,43 +8,34 @@
 #include "ALS_Definitions.h"
 #include "ALS_FunctionLibrary.generated.h"
 
+/**
+ * Compact print program built by the ALS node at compile time and executed by PrintHelperProgram.
+ * Literal text is stored as is and adjacent literals fold into one run. A value slot is the marker
+ * character followed by its slot kind, a literal marker character is stored doubled.
+ */
+struct ALS_API FALSFormatProgram
+{
+    static constexpr TCHAR SlotMarker = TEXT('\x01');
+    static constexpr TCHAR ObjectSlot = TEXT('O');
+    static constexpr TCHAR PropertySlot = TEXT('P');
+
+    static void AppendLiteral(FString& Program, FStringView Literal);
+    static void AppendSlot(FString& Program, EPinType SlotType);
+};
+
 UCLASS()
 class ALS_API UALS_FunctionLibrary : public UBlueprintFunctionLibrary
 {
     GENERATED_BODY()
 
 public:
-    UFUNCTION(
-        BlueprintCallable, 
-        CustomThunk, 
-        meta = (WorldContext = "WorldContextObject", CallableWithoutWorldContext, BlueprintInternalUseOnly = "true", DevelopmentOnly,
-        CustomStructureParam = "Value1,Value2,Value3"), Category = "AdvancedLoggingSystem|Intermediate")
-    static void PrintHelperONE(
-        const UObject* WorldContextObject,
-        const FLinearColor Color,
-        const float Duration,
-        const FName Key,
-        const EPrintMode PrintMode,
-        const ELogSeverity LogSeverity,
-        const bool DrawDebug,
-        const FVector TextLocation,
-        const UObject* BaseObject,
-        const FString SourceID,
-        const TArray<EPinType>& PinTypes,
-        const TArray<FString>& UnConnectedValues,
-        const int32 Value1,
-        const int32 Value2,
-        const int32 Value3
-    );
-    DECLARE_FUNCTION(execPrintHelperONE);
-
-
+    // Executes a format program compiled by the ALS node. Connected values follow as variadic arguments, one per value slot in the program
     UFUNCTION(
         BlueprintCallable,
         CustomThunk,
-        meta = (WorldContext = "WorldContextObject", CallableWithoutWorldContext, BlueprintInternalUseOnly = "true", DevelopmentOnly,
-        CustomStructureParam = "Value1,Value2,Value3,Value4,Value5"), Category = "AdvancedLoggingSystem|Intermediate")
-    static void PrintHelperTWO(
+        meta = (WorldContext = "WorldContextObject", CallableWithoutWorldContext, BlueprintInternalUseOnly = "true", DevelopmentOnly, Variadic),
+        Category = "AdvancedLoggingSystem|Intermediate")
+    static void PrintHelperProgram(
         const UObject* WorldContextObject,
         const FLinearColor Color,
         const float Duration,
@@ -55,87 +46,16 @@ public:
         const FVector TextLocation,
         const UObject* BaseObject,
         const FString SourceID,
-        const TArray<EPinType>& PinTypes,
-        const TArray<FString>& UnConnectedValues,
-        const int32 Value1,
-        const int32 Value2,
-        const int32 Value3,
-        const int32 Value4,
-        const int32 Value5
+        const FString& FormatProgram
     );
-    DECLARE_FUNCTION(execPrintHelperTWO);
-
-
-    UFUNCTION(
-        BlueprintCallable,
-        CustomThunk,
-        meta = (WorldContext = "WorldContextObject", CallableWithoutWorldContext, BlueprintInternalUseOnly = "true", DevelopmentOnly,
-        CustomStructureParam = "Value1,Value2,Value3,Value4,Value5,Value6,Value7"), Category = "AdvancedLoggingSystem|Intermediate")
-    static void PrintHelperTHREE(
-        const UObject* WorldContextObject,
-        const FLinearColor Color,
-        const float Duration,
-        const FName Key,
-        const EPrintMode PrintMode,
-        const ELogSeverity LogSeverity,
-        const bool DrawDebug,
-        const FVector TextLocation,
-        const UObject* BaseObject,
-        const FString SourceID,
-        const TArray<EPinType>& PinTypes,
-        const TArray<FString>& UnConnectedValues,
-        const int32 Value1,
-        const int32 Value2,
-        const int32 Value3,
-        const int32 Value4,
-        const int32 Value5,
-        const int32 Value6,
-        const int32 Value7
-    );
-    DECLARE_FUNCTION(execPrintHelperTHREE);
-
-
-    UFUNCTION(
-        BlueprintCallable,
-        CustomThunk,
-        meta = (WorldContext = "WorldContextObject", CallableWithoutWorldContext, BlueprintInternalUseOnly = "true", DevelopmentOnly,
-        CustomStructureParam = "Value1,Value2,Value3,Value4,Value5,Value6,Value7,Value8,Value9,Value10"), Category = "AdvancedLoggingSystem|Intermediate")
-    static void PrintHelperFOUR(
-        const UObject* WorldContextObject,
-        const FLinearColor Color,
-        const float Duration,
-        const FName Key,
-        const EPrintMode PrintMode,
-        const ELogSeverity LogSeverity,
-        const bool DrawDebug,
-        const FVector TextLocation,
-        const UObject* BaseObject,
-        const FString SourceID,
-        const TArray<EPinType>& PinTypes,
-        const TArray<FString>& UnConnectedValues,
-        const int32 Value1,
-        const int32 Value2,
-        const int32 Value3,
-        const int32 Value4,
-        const int32 Value5,
-        const int32 Value6,
-        const int32 Value7,
-        const int32 Value8,
-        const int32 Value9,
-        const int32 Value10
-    );
-    DECLARE_FUNCTION(execPrintHelperFOUR);
-
-
-    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", DevelopmentOnly), Category = "AdvancedLoggingSystem|Intermediate")
-    static void PrintHelperEmpty();
+    DECLARE_FUNCTION(execPrintHelperProgram);
 
 private:
-    static FString ProcessProperty(
+    static void ExecuteFormatProgram(
         FFrame& Stack,
-        TArray<EPinType>& PinTypes,
-        TArray<FString>& LiteralStrings,
-        int32 MaxValue
+        const FString& FormatProgram,
+        FStringBuilderBase& OutValue,
+        int32 FloatPrecision
     );
 
     static void ProcessPrint(
@@ -7,9 +7,12 @@
 #include "vector"
 #include "utility"
 #include "type_traits"
+#include "atomic"
 #include "ALS_FileLog.h"
 #include "ALS_Definitions.h"
 #include "ALS_Settings.h"
+#include "ALS_Stats.h"
+#include "ALS_NumberFormat.h"
 #include "DrawDebugHelpers.h"
 #include "GameplayTagContainer.h"
 #include "Kismet/KismetSystemLibrary.h"
@@ -27,16 +30,16 @@ class ALS_API UALS_Globals
 {
 public:
     static FString GetNetworkContextTag(const UObject* Context);
-    static void ConvertToString_Property(FProperty* Property, const void* ValuePtr, FStringBuilderBase& OutBuilder);
+    static void ConvertToString_Property(FProperty* Property, const void* ValuePtr, FStringBuilderBase& OutBuilder, int32 FloatPrecision = FALSNumberFormat::DefaultPrecision);
 
 private:
     static void ConvertToString_Direct(FProperty* Property, const void* ValuePtr, FStringBuilderBase& OutBuilder);
     static void ConvertToString_Byte(FByteProperty* ByteProperty, const void* BytePtr, FStringBuilderBase& OutBuilder);
-    static void ConvertToString_Array(FScriptArrayHelper& ArrayHelper, FArrayProperty* ArrayProperty, FStringBuilderBase& OutBuilder);
-    static void ConvertToString_Set(FScriptSetHelper& SetHelper, FSetProperty* SetProperty, FStringBuilderBase& OutBuilder);
-    static void ConvertToString_Map(FScriptMapHelper& MapHelper, FMapProperty* MapProperty, FStringBuilderBase& OutBuilder);
-    static bool FormatInlineStruct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder);
-    static void ConvertToString_Struct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder);
+    static void ConvertToString_Array(FScriptArrayHelper& ArrayHelper, FArrayProperty* ArrayProperty, FStringBuilderBase& OutBuilder, int32 FloatPrecision);
+    static void ConvertToString_Set(FScriptSetHelper& SetHelper, FSetProperty* SetProperty, FStringBuilderBase& OutBuilder, int32 FloatPrecision);
+    static void ConvertToString_Map(FScriptMapHelper& MapHelper, FMapProperty* MapProperty, FStringBuilderBase& OutBuilder, int32 FloatPrecision);
+    static bool FormatInlineStruct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder, int32 FloatPrecision);
+    static void ConvertToString_Struct(const UScriptStruct* StructType, const void* StructPtr, FStringBuilderBase& OutBuilder, int32 FloatPrecision);
 
     //---------------------------------------------------------------------------------------------------------------------------------
 
@@ -44,6 +47,43 @@ public:
     static void LogOutput(const FString& Value, ELogSeverity Level);
     static void GetContextAndNetwork(const UObject* InContext, FString& OutCaller, FString& OutNetwork);
 
+    // Same caller string as GetContextAndNetwork, appended without copying it into an FString
+    static void AppendContextCaller(const UObject* InContext, FStringBuilderBase& OutCaller);
+    static void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+private:
+    // Formatted caller and network tag of an object, rebuilt when its world changes net mode
+    struct FContextStrings
+    {
+        ENetMode NetMode = NM_MAX;
+        FString Caller;
+        FString Network;
+    };
+
+    static inline FCriticalSection ContextCacheLock;
+    static inline TMap<TWeakObjectPtr<const UObject>, FContextStrings> ContextCache;
+
+    // Caller must hold ContextCacheLock
+    static const FContextStrings& FindOrAddContextStrings(const UObject* InContext);
+
+    // Screen prints from other threads, shown by the game thread in one batch per frame
+    struct FPendingScreenPrint
+    {
+        FString SourceID;
+        FString Text;
+        FName Key;
+        float Duration = 0.0f;
+        FColor Color;
+    };
+
+    static inline TQueue<FPendingScreenPrint, EQueueMode::Mpsc> PendingScreenPrints;
+    static inline std::atomic<bool> bScreenFlushScheduled = false;
+
+    static void FlushPendingScreenPrints();
+
+    // "[ThreadName #ThreadId]", the caller shown for records that come from a thread rather than an object
+    static const FString& GetThreadCaller();
+
 public:
     static void PrintALS(
         const FString& Value, 
@@ -63,6 +103,14 @@ public:
         bool InitiateFileLog = true
     );
 
+    // Safe from any thread and without a UObject context. PrintALS and DrawALS forward here when called off the game thread
+    static void PrintALSAnyThread(
+        const FString& Value,
+        const FPrintConfig& PrintConfig,
+        const FString& SourceID,
+        bool InitiateFileLog = true
+    );
+
     static inline FString GetDisplayNameSafe(UObject* Object)
     {
         return IsValid(Object) ? UKismetSystemLibrary::GetDisplayName(Object) : TEXT("Null Object");
@@ -106,9 +154,21 @@ public:
     template<typename> struct TIsStdPair : std::false_type {};
     template<typename K, typename V> struct TIsStdPair<std::pair<K, V>> : std::true_type {};
 
+    // Thread-local builder the variadic Print/Log helpers format their whole argument pack into
+    static FStringBuilderBase& GetFormatBuilder();
+
 public:
     template<typename T>
-    static FString ConvertToStringCPP(const T& InValue)
+    static FString ConvertToStringCPP(const T& InValue, int32 FloatPrecision = FALSNumberFormat::DefaultPrecision)
+    {
+        TStringBuilder<256> Builder;
+        ConvertToStringCPP(Builder, InValue, FloatPrecision);
+        return FString(Builder.ToView());
+    }
+
+    // Appends InValue to OutBuilder. Containers, pairs and nested values are formatted in place without temporary strings
+    template<typename T>
+    static void ConvertToStringCPP(FStringBuilderBase& OutBuilder, const T& InValue, int32 FloatPrecision = FALSNumberFormat::DefaultPrecision)
     {
         using U = std::decay_t<T>;
 
@@ -144,11 +204,12 @@ public:
             if (const UEnum* E = StaticEnum<U>())
             {
                 int64 V = static_cast<int64>(InValue);
-                return E->GetName() + TEXT("::") + E->GetDisplayNameTextByValue(V).ToString();
+                OutBuilder << E->GetName() << TEXT("::") << E->GetDisplayNameTextByValue(V).ToString();
+                return;
             }
 
             using Underlying = std::underlying_type_t<U>;
-            return FString::Printf(TEXT("%d"), static_cast<Underlying>(InValue));
+            OutBuilder.Appendf(TEXT("%d"), static_cast<Underlying>(InValue));
         }
         else if constexpr (bIsEnumAsByte)
         {
@@ -158,45 +219,65 @@ public:
 
             if (const UEnum* E = StaticEnum<EnumType>())
             {
-                return E->GetNameStringByValue(Val);
+                OutBuilder << E->GetNameStringByValue(Val);
+                return;
             }
 
-            return FString::Printf(TEXT("%u"), Val);
+            OutBuilder.Appendf(TEXT("%u"), Val);
         }
         else if constexpr (bIsArray || bIsSet || bIsMap)
         {
-            FStringBuilderBase Builder;
-            if (InValue.Num() == 0) return TEXT("Empty");
+            if (InValue.Num() == 0)
+            {
+                OutBuilder << TEXT("Empty");
+                return;
+            }
 
             int32 Index = 0;
             for (auto& Elem : InValue)
             {
+                OutBuilder << TEXT("\n");
+                FALSNumberFormat::AppendInt(OutBuilder, Index++);
+                OutBuilder << TEXT(" -> ");
+
                 if constexpr (bIsMap)
                 {
-                    Builder.Appendf(TEXT("\n%d -> [K: %s, V: %s]"), Index++, *ConvertToStringCPP(Elem.Key), *ConvertToStringCPP(Elem.Value));
+                    OutBuilder << TEXT("[K: ");
+                    ConvertToStringCPP(OutBuilder, Elem.Key, FloatPrecision);
+                    OutBuilder << TEXT(", V: ");
+                    ConvertToStringCPP(OutBuilder, Elem.Value, FloatPrecision);
+                    OutBuilder << TEXT("]");
                 }
                 else
                 {
-                    Builder.Appendf(TEXT("\n%d -> %s"), Index++, *ConvertToStringCPP(Elem));
+                    ConvertToStringCPP(OutBuilder, Elem, FloatPrecision);
                 }
             }
-            return Builder.ToString();
         }
         else if constexpr (bIsPair)
         {
-            return FString::Printf(TEXT("[first: %s, second: %s]"), *ConvertToStringCPP(InValue.first), *ConvertToStringCPP(InValue.second));
+            OutBuilder << TEXT("[first: ");
+            ConvertToStringCPP(OutBuilder, InValue.first, FloatPrecision);
+            OutBuilder << TEXT(", second: ");
+            ConvertToStringCPP(OutBuilder, InValue.second, FloatPrecision);
+            OutBuilder << TEXT("]");
         }
         else if constexpr (bIsStdVector)
         {
-            FStringBuilderBase Builder;
-            if (InValue.empty()) return TEXT("Empty std::vector");
+            if (InValue.empty())
+            {
+                OutBuilder << TEXT("Empty std::vector");
+                return;
+            }
 
             int32 Index = 0;
             for (auto& Elem : InValue)
             {
-                Builder.Appendf(TEXT("\n%d -> %s"), Index++, *ConvertToStringCPP(Elem));
+                OutBuilder << TEXT("\n");
+                FALSNumberFormat::AppendInt(OutBuilder, Index++);
+                OutBuilder << TEXT(" -> ");
+                ConvertToStringCPP(OutBuilder, Elem, FloatPrecision);
             }
-            return Builder.ToString();
         }
         else if constexpr (bIsStruct)
         {
@@ -204,52 +285,61 @@ public:
             {
                 if (const UScriptStruct* SS = Cast<UScriptStruct>(T::StaticStruct()))
                 {
-                    FStringBuilderBase Builder;
-                    ConvertToString_Struct(SS, &InValue, Builder);
-                    return Builder.ToString();
+                    ConvertToString_Struct(SS, &InValue, OutBuilder, FloatPrecision);
+                    return;
                 }
             }
-            return TEXT("Invalid Struct");
+            OutBuilder << TEXT("Invalid Struct");
         }
         else if constexpr (bIsBool)
         {
-            return InValue ? TEXT("True") : TEXT("False");
+            OutBuilder << (InValue ? TEXT("True") : TEXT("False"));
         }
         else if constexpr (bIsArithmetic)
         {
             if constexpr (std::is_floating_point_v<U>)
-                return FString::Printf(TEXT("%f"), static_cast<double>(InValue));
+                FALSNumberFormat::AppendFixed(OutBuilder, static_cast<double>(InValue), FloatPrecision);
+            else if constexpr (std::is_unsigned_v<U>)
+                FALSNumberFormat::AppendUInt(OutBuilder, static_cast<uint64>(InValue));
             else
-                return FString::Printf(TEXT("%lld"), static_cast<long long>(InValue));
+                FALSNumberFormat::AppendInt(OutBuilder, static_cast<int64>(InValue));
         }
         else if constexpr (bIsString)
         {
-            if constexpr (bIsFString)        return InValue;
-            else if constexpr (bIsFName)     return InValue.ToString();
-            else if constexpr (bIsFText)     return InValue.ToString(); 
-            else if constexpr (bIsCString)   return FString(InValue);
-            else if constexpr (bIsStdString) return FString(InValue.c_str());
-            else return FString(InValue);
+            if constexpr (bIsFString)        OutBuilder << InValue;
+            else if constexpr (bIsFName)     InValue.AppendString(OutBuilder);
+            else if constexpr (bIsFText)     OutBuilder << InValue.ToString();
+            else if constexpr (bIsCString)   OutBuilder << InValue;
+            else if constexpr (bIsStdString)
+            {
+                auto Converted = StringCast<TCHAR>(InValue.c_str(), static_cast<int32>(InValue.size()));
+                OutBuilder.Append(Converted.Get(), Converted.Length());
+            }
+            else
+            {
+                auto Converted = StringCast<TCHAR>(InValue);
+                OutBuilder.Append(Converted.Get(), Converted.Length());
+            }
         }
         else if constexpr (std::is_same_v<U, FRotator>)
         {
-            return FString::Printf(TEXT("P: %f, Y: %f, R: %f"),
-                InValue.Pitch, InValue.Yaw, InValue.Roll);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("P: "), TEXT(", Y: "), TEXT(", R: ") },
+                { InValue.Pitch, InValue.Yaw, InValue.Roll }, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FVector>)
         {
-            return FString::Printf(TEXT("X: %f, Y: %f, Z: %f"),
-                InValue.X, InValue.Y, InValue.Z);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: "), TEXT(", Z: ") },
+                { InValue.X, InValue.Y, InValue.Z }, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FVector2D>)
         {
-            return FString::Printf(TEXT("X: %f, Y: %f"),
-                InValue.X, InValue.Y);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: ") },
+                { InValue.X, InValue.Y }, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FVector4>)
         {
-            return FString::Printf(TEXT("X: %f, Y: %f, Z: %f, W: %f"),
-                InValue.X, InValue.Y, InValue.Z, InValue.W);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: "), TEXT(", Z: "), TEXT(", W: ") },
+                { InValue.X, InValue.Y, InValue.Z, InValue.W }, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FTransform>)
         {
@@ -257,168 +347,164 @@ public:
             auto Loc = Tm.GetLocation();
             auto Rot = Tm.Rotator();
             auto Scale = Tm.GetScale3D();
-            return FString::Printf(
-                TEXT("[Location] %.3f,%.3f,%.3f -- [Rotation] %.6f,%.6f,%.6f -- [Scale] %.3f,%.3f,%.3f"),
-                Loc.X, Loc.Y, Loc.Z,
-                Rot.Pitch, Rot.Yaw, Rot.Roll,
-                Scale.X, Scale.Y, Scale.Z
-            );
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("[Location] "), TEXT(","), TEXT(",") }, { Loc.X, Loc.Y, Loc.Z }, 3);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT(" -- [Rotation] "), TEXT(","), TEXT(",") }, { Rot.Pitch, Rot.Yaw, Rot.Roll }, 6);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT(" -- [Scale] "), TEXT(","), TEXT(",") }, { Scale.X, Scale.Y, Scale.Z }, 3);
         }
         else if constexpr (std::is_same_v<U, FQuat>)
         {
-            return FString::Printf(TEXT("X: %f, Y: %f, Z: %f, W: %f"), InValue.X, InValue.Y, InValue.Z, InValue.W);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: "), TEXT(", Z: "), TEXT(", W: ") },
+                { InValue.X, InValue.Y, InValue.Z, InValue.W }, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FMatrix>)
         {
-            FString S;
+            OutBuilder << TEXT("FMatrix:\n");
             for (int R = 0; R < 4; ++R)
-                S += FString::Printf(TEXT("[ %f, %f, %f, %f ]\n"), InValue.M[R][0], InValue.M[R][1], InValue.M[R][2], InValue.M[R][3]);
-            return TEXT("FMatrix:\n") + S;
+            {
+                FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("[ "), TEXT(", "), TEXT(", "), TEXT(", ") },
+                    { InValue.M[R][0], InValue.M[R][1], InValue.M[R][2], InValue.M[R][3] }, FloatPrecision);
+                OutBuilder << TEXT(" ]\n");
+            }
         }
         else if constexpr (std::is_same_v<U, FPlane>)
         {
-            return FString::Printf(TEXT("X: %f, Y: %f, Z: %f, W: %f"),
-                InValue.X, InValue.Y, InValue.Z, InValue.W);
-        }
-        else if constexpr (std::is_same_v<U, FBox>)
-        {
-            return FString::Printf(TEXT("Min: %s, Max: %s"),
-                *ConvertToStringCPP(InValue.Min),
-                *ConvertToStringCPP(InValue.Max));
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("X: "), TEXT(", Y: "), TEXT(", Z: "), TEXT(", W: ") },
+                { InValue.X, InValue.Y, InValue.Z, InValue.W }, FloatPrecision);
         }
-        else if constexpr (std::is_same_v<U, FBox2D>)
+        else if constexpr (std::is_same_v<U, FBox> || std::is_same_v<U, FBox2D>)
         {
-            return FString::Printf(TEXT("Min: %s, Max: %s"),
-                *ConvertToStringCPP(InValue.Min),
-                *ConvertToStringCPP(InValue.Max));
+            OutBuilder << TEXT("Min: ");
+            ConvertToStringCPP(OutBuilder, InValue.Min, FloatPrecision);
+            OutBuilder << TEXT(", Max: ");
+            ConvertToStringCPP(OutBuilder, InValue.Max, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FColor>)
         {
-            return FString::Printf(TEXT("R: %d, G: %d, B: %d, A: %d"),
+            OutBuilder.Appendf(TEXT("R: %d, G: %d, B: %d, A: %d"),
                 InValue.R, InValue.G, InValue.B, InValue.A);
         }
         else if constexpr (std::is_same_v<U, FLinearColor>)
         {
-            return FString::Printf(TEXT("R: %f, G: %f, B: %f, A: %f"),
-                InValue.R, InValue.G, InValue.B, InValue.A);
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("R: "), TEXT(", G: "), TEXT(", B: "), TEXT(", A: ") },
+                { InValue.R, InValue.G, InValue.B, InValue.A }, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FIntPoint>)
         {
-            return FString::Printf(TEXT("X: %d, Y: %d"),
+            OutBuilder.Appendf(TEXT("X: %d, Y: %d"),
                 InValue.X, InValue.Y);
         }
         else if constexpr (std::is_same_v<U, FIntVector>)
         {
-            return FString::Printf(TEXT("X: %d, Y: %d, Z: %d"),
+            OutBuilder.Appendf(TEXT("X: %d, Y: %d, Z: %d"),
                 InValue.X, InValue.Y, InValue.Z);
         }
         else if constexpr (std::is_same_v<U, FIntVector2>)
         {
-            return FString::Printf(TEXT("X: %d, Y: %d"), InValue.X, InValue.Y);
+            OutBuilder.Appendf(TEXT("X: %d, Y: %d"), InValue.X, InValue.Y);
         }
         else if constexpr (std::is_same_v<U, FIntVector4>)
         {
-            return FString::Printf(TEXT("X: %d, Y: %d, Z: %d, W: %d"),
+            OutBuilder.Appendf(TEXT("X: %d, Y: %d, Z: %d, W: %d"),
                                    InValue.X, InValue.Y, InValue.Z, InValue.W);
         }
         else if constexpr (std::is_same_v<U, FUintVector2> || std::is_same_v<U, FUint32Vector2>)
         {
-            return FString::Printf(TEXT("X: %u, Y: %u"), InValue.X, InValue.Y);
+            OutBuilder.Appendf(TEXT("X: %u, Y: %u"), InValue.X, InValue.Y);
         }
         else if constexpr (std::is_same_v<U, FUintVector3> || std::is_same_v<U, FUint32Vector3>)
         {
-            return FString::Printf(TEXT("X: %u, Y: %u, Z: %u"), InValue.X, InValue.Y, InValue.Z);
+            OutBuilder.Appendf(TEXT("X: %u, Y: %u, Z: %u"), InValue.X, InValue.Y, InValue.Z);
         }
         else if constexpr (std::is_same_v<U, FUintVector4> || std::is_same_v<U, FUint32Vector4>)
         {
-            return FString::Printf(TEXT("X: %u, Y: %u, Z: %u, W: %u"),
+            OutBuilder.Appendf(TEXT("X: %u, Y: %u, Z: %u, W: %u"),
                                    InValue.X, InValue.Y, InValue.Z, InValue.W);
         }
         else if constexpr (std::is_same_v<U, FIntRect>)
         {
-            return FString::Printf(TEXT("Min:(%d,%d)  Max:(%d,%d)"),
+            OutBuilder.Appendf(TEXT("Min:(%d,%d)  Max:(%d,%d)"),
                                    InValue.Min.X, InValue.Min.Y, InValue.Max.X, InValue.Max.Y);
         }
         else if constexpr (std::is_same_v<U, FUintRect>)
         {
-            return FString::Printf(TEXT("Min:(%u,%u)  Max:(%u,%u)"),
+            OutBuilder.Appendf(TEXT("Min:(%u,%u)  Max:(%u,%u)"),
                                    InValue.Min.X, InValue.Min.Y, InValue.Max.X, InValue.Max.Y);
         }
-        else if constexpr (std::is_same_v<U, FBoxSphereBounds>)
-        {
-            return FString::Printf(TEXT("Origin:%s  Extent:%s  Radius:%f"),
-                   *ConvertToStringCPP(InValue.Origin),
-                   *ConvertToStringCPP(InValue.BoxExtent),
-                   InValue.SphereRadius);
-        }
-        else if constexpr (std::is_same_v<U, FCompactBoxSphereBounds>)
+        else if constexpr (std::is_same_v<U, FBoxSphereBounds> || std::is_same_v<U, FCompactBoxSphereBounds>)
         {
-            return FString::Printf(TEXT("Origin:%s  Extent:%s  Radius:%f"),
-                *ConvertToStringCPP(InValue.Origin),
-                *ConvertToStringCPP(InValue.BoxExtent),
-                InValue.SphereRadius);
+            OutBuilder << TEXT("Origin:");
+            ConvertToStringCPP(OutBuilder, InValue.Origin, FloatPrecision);
+            OutBuilder << TEXT("  Extent:");
+            ConvertToStringCPP(OutBuilder, InValue.BoxExtent, FloatPrecision);
+            OutBuilder << TEXT("  Radius:");
+            FALSNumberFormat::AppendFixed(OutBuilder, InValue.SphereRadius, FloatPrecision);
         }
         else if constexpr (std::is_same_v<U, FCollisionProfileName>)
         {
-            return InValue.Name.ToString();
+            InValue.Name.AppendString(OutBuilder);
         }
         else if constexpr (std::is_same_v<U, FTimerHandle>)
         {
-            return InValue.IsValid() ? FString::Printf(TEXT("TimerHandle(%llu)"), InValue.GetHandle()) : TEXT("Invalid TimerHandle");
+            if (InValue.IsValid()) OutBuilder.Appendf(TEXT("TimerHandle(%llu)"), InValue.GetHandle());
+            else OutBuilder << TEXT("Invalid TimerHandle");
         }
         else if constexpr (std::is_same_v<U, FSoftObjectPath>)
         {
-            return InValue.IsNull() ? TEXT("Null SoftObjectPath") : InValue.ToString();
+            if (InValue.IsNull()) OutBuilder << TEXT("Null SoftObjectPath");
+            else InValue.AppendString(OutBuilder);
         }
         else if constexpr (std::is_same_v<U, FSoftClassPath>)
         {
-            return InValue.IsNull() ? TEXT("Null SoftClassPath")  : InValue.ToString();
+            if (InValue.IsNull()) OutBuilder << TEXT("Null SoftClassPath");
+            else InValue.AppendString(OutBuilder);
         }
         else if constexpr (std::is_same_v<U, FPrimaryAssetId>)
         {
-            return InValue.IsValid() ? InValue.ToString() : TEXT("Invalid PrimaryAssetId");
+            OutBuilder << (InValue.IsValid() ? InValue.ToString() : TEXT("Invalid PrimaryAssetId"));
         }
         else if constexpr (std::is_same_v<U, FPrimaryAssetType>)
         {
-            return InValue.ToString();
+            OutBuilder << InValue.ToString();
         }
         else if constexpr (std::is_same_v<U, FGameplayTag>)
         {
-            return InValue.IsValid() ? InValue.ToString() : TEXT("Invalid GameplayTag");
+            if (InValue.IsValid()) InValue.GetTagName().AppendString(OutBuilder);
+            else OutBuilder << TEXT("Invalid GameplayTag");
         }
         else if constexpr (std::is_same_v<U, FGameplayTagContainer>)
         {
-            FString Out;
-            InValue.ToStringSimple(true);
-            return Out.IsEmpty() ? TEXT("Empty TagContainer") : Out;
+            if (InValue.IsEmpty()) OutBuilder << TEXT("Empty TagContainer");
+            else OutBuilder << InValue.ToStringSimple(true);
         }
         else if constexpr (std::is_same_v<U, FFloatRange>)
         {
-            return FString::Printf(TEXT("[%.3f – %.3f]"),
-                   InValue.GetLowerBoundValue(), InValue.GetUpperBoundValue());
+            FALSNumberFormat::AppendComponents(OutBuilder, { TEXT("["), TEXT(" – ") },
+                { InValue.GetLowerBoundValue(), InValue.GetUpperBoundValue() }, 3);
+            OutBuilder << TEXT("]");
         }
         else if constexpr (std::is_same_v<U, FInt32Range>)
         {
-            return FString::Printf(TEXT("[%d – %d]"),
+            OutBuilder.Appendf(TEXT("[%d – %d]"),
                    InValue.GetLowerBoundValue(), InValue.GetUpperBoundValue());
         }
         else if constexpr (TALS_IsOptional<U>::value)
         {
-            return InValue.IsSet() ? ConvertToStringCPP(*InValue) : TEXT("Unset Optional");
+            if (InValue.IsSet()) ConvertToStringCPP(OutBuilder, *InValue, FloatPrecision);
+            else OutBuilder << TEXT("Unset Optional");
         }
         else if constexpr (std::is_same_v<U, FRandomStream>)
         {
-            return FString::Printf(TEXT("%d"), InValue.GetInitialSeed());
+            OutBuilder.Appendf(TEXT("%d"), InValue.GetInitialSeed());
         }
         else if constexpr (std::is_same_v<U, FGuid>)
         {
-            return InValue.ToString();
+            InValue.AppendString(OutBuilder);
         }
         else if constexpr (std::is_same_v<U, FDateTime>)
         {
-            FString Base = InValue.ToString(TEXT("%Y-%m-%d %H:%M:%S"));
-            int32 MS = InValue.GetMillisecond();
-            return FString::Printf(TEXT("%s.%03d"), *Base, MS);
+            OutBuilder.Appendf(TEXT("%04d-%02d-%02d %02d:%02d:%02d.%03d"),
+                InValue.GetYear(), InValue.GetMonth(), InValue.GetDay(),
+                InValue.GetHour(), InValue.GetMinute(), InValue.GetSecond(), InValue.GetMillisecond());
         }
         else if constexpr (std::is_same_v<U, FTimespan>)
         {
@@ -427,35 +513,32 @@ public:
             int32 M = InValue.GetMinutes();
             int32 S = InValue.GetSeconds();
             int32 MS = static_cast<int32>(InValue.GetTotalMilliseconds()) % 1000;
-            return FString::Printf(TEXT("%dD %02d:%02d:%02d.%03d"), D, H, M, S, MS);
+            OutBuilder.Appendf(TEXT("%dD %02d:%02d:%02d.%03d"), D, H, M, S, MS);
         }
         else if constexpr (std::is_pointer_v<U> && std::is_base_of_v<UObject, std::remove_pointer_t<U>>)
         {
-			return GetDisplayNameSafe(InValue);
+            OutBuilder << GetDisplayNameSafe(InValue);
         }
         else if constexpr (std::is_base_of_v<UObject, std::remove_reference_t<U>>)
         {
-            return GetDisplayNameSafe(&InValue);
-        }
-        else if constexpr (std::is_pointer_v<U> && std::is_arithmetic_v<std::remove_pointer_t<U>>)
-        {
-            return InValue ? ConvertToStringCPP(*InValue) : TEXT("Null Pointer");
+            OutBuilder << GetDisplayNameSafe(&InValue);
         }
         else if constexpr (std::is_pointer_v<U>)
         {
-            return InValue ? ConvertToStringCPP(*InValue) : TEXT("Null Pointer");
+            if (InValue) ConvertToStringCPP(OutBuilder, *InValue, FloatPrecision);
+            else OutBuilder << TEXT("Null Pointer");
         }
         else if constexpr (bIsWeakPtr || bIsSubclass || bIsSharedPtr || bIsSharedRef || bIsUniquePtr)
         {
-            return GetDisplayNameSafe(InValue.Get());
+            OutBuilder << GetDisplayNameSafe(InValue.Get());
         }
         else if constexpr (bIsSoftClass)
         {
-            return InValue.IsValid() ? *InValue.GetAssetName() : TEXT("Null TSoftClassPtr");
+            OutBuilder << (InValue.IsValid() ? InValue.GetAssetName() : TEXT("Null TSoftClassPtr"));
         }
         else if constexpr (bIsSoftObject)
         {
-            return InValue.IsValid() ? *InValue.GetAssetName() : TEXT("Null TSoftObjectPtr");
+            OutBuilder << (InValue.IsValid() ? InValue.GetAssetName() : TEXT("Null TSoftObjectPtr"));
         }
         else
         {
@@ -466,10 +549,15 @@ public:
     template <typename... Args>
     static inline void PrintALSCPP(const FPrintConfig& PrintConfig, const UObject* Context, const FString& SourceID, Args&&... Arguments)
     {
-        TArray<FString> Messages;
-        Messages.Reserve(sizeof...(Arguments)); 
-        (Messages.Add(ConvertToStringCPP(std::forward<Args>(Arguments))), ...);
-        FString FormattedString = FString::Join(Messages, TEXT(""));
+        FString FormattedString;
+        {
+            ALS_STAT_SCOPE(Format);
+
+            FStringBuilderBase& Builder = GetFormatBuilder();
+            (ConvertToStringCPP(Builder, Arguments, PrintConfig.FloatPrecision), ...);
+            FormattedString = FString(Builder.ToView());
+        }
+
         PrintALS(FormattedString, PrintConfig, Context, SourceID);
     }
 
@@ -492,10 +580,42 @@ public:
             static_assert([] { return false; }(),"Print3D: First argument must be an Vector, Actor or a SceneComponent");
         }
 
-        TArray<FString> Messages;
-        Messages.Reserve(sizeof...(Arguments)); 
-        (Messages.Add(ConvertToStringCPP(std::forward<Args>(Arguments))), ...);
-        FString FormattedString = FString::Join(Messages, TEXT(""));
+        FString FormattedString;
+        {
+            ALS_STAT_SCOPE(Format);
+
+            FStringBuilderBase& Builder = GetFormatBuilder();
+            (ConvertToStringCPP(Builder, Arguments, PrintConfig.FloatPrecision), ...);
+            FormattedString = FString(Builder.ToView());
+        }
+
         DrawALS(FormattedString, TextObject, TextLocation, PrintConfig, Context, SourceID);
     }
 };
+
+
+// Per call site gates behind LogOnce, LogEveryN and LogEveryXSeconds. Each call site owns its own static state
+namespace ALSCallSite
+{
+    FORCEINLINE bool PassOnce(std::atomic<bool>& bDone)
+    {
+        return !bDone.load(std::memory_order_relaxed) && !bDone.exchange(true, std::memory_order_relaxed);
+    }
+
+    // First hit passes, then every Nth one. Counted per thread, so a hot call site never contends on a shared counter
+    FORCEINLINE bool PassEveryN(uint32& HitCount, uint32 N)
+    {
+        return HitCount++ % FMath::Max(N, 1u) == 0;
+    }
+
+    // First hit passes, then at most one per interval. Only the thread that moves the deadline gets through
+    FORCEINLINE bool PassEveryXSeconds(std::atomic<uint64>& NextCycles, double Seconds)
+    {
+        const uint64 Now = FPlatformTime::Cycles64();
+        uint64 Next = NextCycles.load(std::memory_order_relaxed);
+        if (Now < Next) return false;
+
+        const uint64 Interval = static_cast<uint64>(FMath::Max(Seconds, 0.0) / FPlatformTime::GetSecondsPerCycle64());
+        return NextCycles.compare_exchange_strong(Next, Now + Interval, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,35 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+// Compressed archived logs. The file is a small header followed by independently compressed blocks, so it can be written and read back as a stream
+class ALS_API FALSLogArchive
+{
+public:
+    static constexpr const TCHAR* ArchiveExtension = TEXT(".alsz");
+
+    static bool IsArchivePath(const FString& FilePath);
+
+    // Streams SourcePath into a compressed archive at ArchivePath, block by block. ShouldContinue runs before each block, returning false abandons the archive
+    static bool CompressLogFile(const FString& SourcePath, const FString& ArchivePath, TFunctionRef<bool()> ShouldContinue = []() { return true; });
+
+    // Sequential reader for plain, segmented or compressed logs, sizes and positions are always in uncompressed bytes
+    static FArchive* CreateReader(const FString& FilePath);
+
+    // Reader for one plain or compressed file, a manifest next to it is not followed
+    static FArchive* CreateFileReader(const FString& FilePath);
+
+    static bool LoadToString(const FString& FilePath, FString& OutContent);
+
+    // Uncompressed size of the log in bytes, INDEX_NONE if it cannot be read
+    static int64 GetLogSize(const FString& FilePath);
+
+    // Uncompressed size of one plain or compressed file, without its other segments
+    static int64 GetFileSize(const FString& FilePath);
+
+    // Deletes the oldest instances in ArchiveDir until it fits in MaxBytes. An instance's segments, manifest and sidecar go together
+    static void EnforceQuota(const FString& ArchiveDir, int64 MaxBytes);
+};
@@ -0,0 +1,77 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "ALS_FileLog.h"
+
+// One parsed line of an ALS log file
+struct ALS_API FALSLogRecord
+{
+    // Monotonic nanoseconds for current records, the legacy cycle counter for older ones
+    uint64 Timestamp = 0;
+    bool bIsMonotonic = false;
+
+    // Only written by older versions, current records are formatted at display time
+    FString DateTime;
+
+    // GFrameCounter when the record was written, INDEX_NONE for records written before frames were tagged
+    int64 Frame = INDEX_NONE;
+
+    // Set for records written off the game thread, 0 and empty otherwise
+    uint32 ThreadId = 0;
+    FString ThreadName;
+
+    // Aggregate records such as timer summaries
+    bool bIsSummary = false;
+
+    // Trailer of a collapsed run: the message was repeated this many more times, from RepeatStartNs up to RepeatEndNs
+    int32 Repeats = 0;
+    uint64 RepeatStartNs = 0;
+    uint64 RepeatEndNs = 0;
+
+    FString Session;
+    FString Context;
+    FString Source;
+    FString Level;
+    FString Message;
+};
+
+// Reads an ALS log file line by line through a fixed size chunk, so memory stays bounded no matter how large the file is
+class ALS_API FALSLogReader
+{
+public:
+    explicit FALSLogReader(const FString& InFilePath, int32 InChunkSize = 64 * 1024);
+
+    bool IsValid() const { return FileReader.IsValid(); }
+
+    bool ReadLine(FString& OutLine);
+
+    // Where the line last read starts in the logical log, across every segment
+    int64 GetLineOffset() const { return LineOffset; }
+
+    // Continues reading at an offset returned by GetLineOffset
+    bool Seek(int64 Offset);
+
+    static bool ParseRecord(const FString& Line, FALSLogRecord& OutRecord);
+
+    static bool ParseAnchor(const FString& Line, FString& OutSession, FALSClockAnchor& OutAnchor);
+
+    static bool ResolveTime(const FALSLogRecord& Record, const FALSClockAnchor& Anchor, int64& OutUnixNs, FDateTime& OutLocalTime);
+
+private:
+    bool FillBuffer();
+
+    TUniquePtr<FArchive> FileReader;
+    TArray<uint8> Buffer;
+    TArray<uint8> PendingLine;
+    int32 ChunkSize = 0;
+    int32 BufferPos = 0;
+    int32 BufferEnd = 0;
+    int64 BufferOffset = 0;
+    int64 LineOffset = 0;
+    int64 PendingLineOffset = 0;
+    bool bIsUTF16 = false;
+    bool bFirstChunk = true;
+};
@@ -0,0 +1,40 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+/**
+ * A long running instance rolls over from "<Instance>.log" to "<Instance>.0001.log", "<Instance>.0002.log" and so on.
+ * "<Instance>.manifest" lists the segments in order, readers treat them as one logical log addressed by the base path.
+ */
+class ALS_API FALSLogSegments
+{
+public:
+    static constexpr const TCHAR* ManifestExtension = TEXT(".manifest");
+
+    static FString GetManifestPath(const FString& LogFilePath);
+
+    // Segment 0 is the base file itself
+    static FString GetSegmentPath(const FString& LogFilePath, int32 SegmentIndex);
+
+    static bool HasSegments(const FString& LogFilePath);
+
+    // Last segment listed in the manifest, 0 when the log was never rolled over
+    static int32 GetLastSegmentIndex(const FString& LogFilePath);
+
+    static bool AddSegment(const FString& LogFilePath, int32 SegmentIndex);
+
+    // Existing segment files of the logical log, in write order. A segment that was archived compressed resolves to its compressed file
+    static void GetSegmentPaths(const FString& LogFilePath, TArray<FString>& OutSegmentPaths);
+
+    // Maps a file name in LogDir to the instance it belongs to, "X.0002.log" becomes "X" when X has a manifest
+    static FString GetInstanceName(const FString& LogDir, const FString& FileName);
+
+    // Reads all segments back to back as one stream
+    static FArchive* CreateReader(const FString& LogFilePath);
+
+    // Moves the logical log to NewFilePath. Each segment is moved on its own and a manifest is written for the new path
+    static bool MoveLog(const FString& LogFilePath, const FString& NewFilePath);
+};
@@ -0,0 +1,23 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ALS_Definitions.h"
+
+/**
+ * Groups log entries that differ only in their variable parts, "HP: 93" and "HP: 92" become one "HP: <*>" entry.
+ * Numbers, hex values and GUIDs are masked per token, then a Drain style parse tree (level and token count, then the leading tokens)
+ * narrows each message down to a few candidate templates, and the most similar one absorbs it. Chunks are mined in parallel and merged.
+ */
+class ALS_API FALSLogTemplates
+{
+public:
+    static constexpr const TCHAR* Wildcard = TEXT("<*>");
+
+    // Returns one entry per template with the summed count, the time span and the numeric range of every masked position
+    static TArray<FLogEntries> Mine(const TArray<FLogEntries>& Entries);
+
+    // Replaces numbers, hex values and GUIDs in one whitespace separated token. OutValue is the first number, NaN when there is none
+    static bool MaskToken(const FString& Token, FString& OutMasked, double& OutValue);
+};
@@ -9,21 +9,36 @@
 
 class UALS_LogMsgObject;
 class UALS_LogContextObject;
+struct FALSFrameIndex;
 
 DECLARE_DELEGATE_OneParam(FOnGetLogsCompletedNative, const TArray<FLogEntries>&);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnGetLogsCompletedDynamic, const TArray<UALS_LogMsgObject*>&, MessageObjects, bool, IsSuccess, FString, OutMessage);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnGetInstancesCompletedDynamic, const TArray<FString>&, Instances, bool, IsSuccess, FString, OutMessage);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnGetFramesCompletedDynamic, const TArray<FFrameEntries>&, Frames, bool, IsSuccess, FString, OutMessage);
 
 UCLASS(meta = (DisplayName = "ALS LogsViewer"))
 class ALS_API UALS_LogsUMG : public UUserWidget
 {
     GENERATED_BODY()
 
+    // Automation benchmarks drive GetFilteredLogs directly
+    friend struct FALSBenchmarkAccess;
+
 protected:
     TArray<FString> StoredSessions;
 
 protected:
     TSharedPtr<bool> CurrentCancelToken;
 
+    // Frame to record offset index of the instance and session last browsed by frame
+    TSharedPtr<FALSFrameIndex> FrameIndex;
+
+    // Segment of a rolled over log the viewer pages through, INDEX_NONE for the newest
+    int32 ViewedSegment = INDEX_NONE;
+
+    // Builds the index on a worker thread and keeps it as FrameIndex. OnBuilt runs on the game thread, with a null index and the reason on failure
+    void BuildFrameIndex(const FString& Instance, const FString& SessionID, TFunction<void(TSharedPtr<FALSFrameIndex>, const FString&)> OnBuilt);
+
     virtual void NativeConstruct() override;
 
     UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
@@ -41,6 +56,14 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
     bool GetAllInstances(TArray<FString>& OutInstances, FString& OutMessage);
 
+    // Segments of the instance's log, 1 when it never rolled over. The message view loads and size checks each one on its own, timers, metrics and frames always read all of them
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
+    int32 GetNumSegments(const FString& Instance) const;
+
+    // Pages the viewer to one segment, INDEX_NONE goes back to the newest
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
+    void SetViewedSegment(int32 SegmentIndex);
+
     UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
     bool GetAllSessions(const bool IgnoreSizeCheck, const FString& Instance, TArray<FString>& OutSessions, FString& OutMessage);
 
@@ -55,10 +78,42 @@ protected:
         const FString& Context, 
         const FString& SearchMessage, 
         const FString& SearchLevel, 
+        FOnGetLogsCompletedNative OnGetLogsCompleted,
+        bool bGroupByTemplate = false
+    );
+
+    // Timer summary records of the session, grouped by timer and oldest interval first
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
+    bool GetTimerSummaries(const FString& Instance, const FString& SessionID, TArray<FTimerSummaryEntries>& OutSummaries, FString& OutMessage);
+
+    // One series per metric of the session, each value placed in seconds since the first metrics record
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
+    bool GetMetricSeries(const FString& Instance, const FString& SessionID, TArray<FMetricSeriesEntries>& OutSeries, FString& OutMessage);
+
+    // Every frame of the session that logged something, oldest first. Record counts per frame double as a log volume graph. The log is indexed on a worker thread
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
+    void GetFrames(const FString& Instance, const FString& SessionID, bool bRefresh, FOnGetFramesCompletedDynamic OnGetFramesCompleted);
+
+    // Busiest call sites of the session without parsing the log, live totals for the running session plus the instance's sidecar
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
+    bool GetTopTalkers(const FString& Instance, const FString& SessionID, int32 NumTop, TArray<FCallSiteEntries>& OutTalkers, FString& OutMessage);
+
+    // Instances that hold a clock anchor of the session. Every file is scanned on a worker thread, the result arrives on the game thread
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsViewer")
+    void GetSessionInstances(const FString& SessionID, FOnGetInstancesCompletedDynamic OnGetInstancesCompleted);
+
+    void GetMergedLogs(
+        const bool& Descending,
+        const TArray<FString>& Instances,
+        const FString& SessionID,
+        const FString& SearchMessage,
+        const FString& SearchLevel,
         FOnGetLogsCompletedNative OnGetLogsCompleted
     );
 
     bool GetFileContent(const FString Instance, FString& OutContent, FString& OutMessage, bool IgnoreSizeCheck = true);
+
+    FString GetInstanceFilePath(const FString& Instance) const;
     
 
 // Objects Helper Functions
@@ -71,6 +126,33 @@ protected:
         FOnGetLogsCompletedDynamic OnGetLogsCompleted
     );
 
+    // Batches messages that only differ in numbers, hex values or GUIDs into one template entry with its value range
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsUMG")
+    void GetTemplateMessageObjects(
+        const UALS_LogContextObject* ContextObject, 
+        const bool& bDescending, 
+        FOnGetLogsCompletedDynamic OnGetLogsCompleted
+    );
+
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsUMG")
+    void GetMergedMessageObjects(
+        const TArray<FString>& Instances,
+        const FString& SessionID,
+        const FString& SearchMessage,
+        const FString& SearchLevel,
+        const bool& bDescending,
+        FOnGetLogsCompletedDynamic OnGetLogsCompleted
+    );
+
+    // All records of one frame across every context, in the order they were written
+    UFUNCTION(BlueprintCallable, Category = "ALS LogsUMG")
+    void GetFrameMessageObjects(
+        const FString& Instance,
+        const FString& SessionID,
+        int64 Frame,
+        FOnGetLogsCompletedDynamic OnGetLogsCompleted
+    );
+
     UFUNCTION(BlueprintCallable, Category = "ALS LogsUMG")
     void SetContextObjects(
         UListView* ContextList,
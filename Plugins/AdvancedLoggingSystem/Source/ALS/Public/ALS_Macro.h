@@ -4,6 +4,8 @@
 
 #include "ALS_Globals.h"
 #include "ALS_Settings.h"
+#include "ALS_Timers.h"
+#include "ALS_Metrics.h"
 
 // --> This is the unique source id such as (MyActor.cpp:145). Useful to batch unique message in LogViewer when similar messages are called.
 #define SOURCE_ID (FString(FPaths::GetCleanFilename(__FILE__)) + TEXT(":") + FString::FromInt(__LINE__))
@@ -49,6 +51,51 @@
 
 
 
+// -- Any Thread Macros --  Example:- ParallelFor(Num, [&](int32 Index) { LogAnyThread(ELogSeverity::Info, "Chunk ", Index, " done"); });
+// No UObject needed. Safe in ParallelFor bodies, async tasks and worker threads, the record names the thread it came from
+//----------------------------------------------------------------------------------------------------------------------
+
+#define PrintAnyThread(Preset, ...)  UALS_Globals::PrintALSCPP(GETCONFIG(Preset), nullptr, SOURCE_ID, __VA_ARGS__)
+#define LogAnyThread(Level, ...)  UALS_Globals::PrintALSCPP(FPrintConfig(NAME_None, 0.0f, FColor::White, Level, EPrintMode::LogOnly), nullptr, SOURCE_ID, __VA_ARGS__)
+
+
+
+// -- Call Site Gated Macros --  Example:- LogEveryN(100, LogWarn, "Queue still full: ", Queue.Num());
+// Wraps any ALS macro above. Suppressed hits skip the arguments and SOURCE_ID entirely, the gate lives at the call site
+//----------------------------------------------------------------------------------------------------------------------
+
+#define LogOnce(Macro, ...) do { static std::atomic<bool> bALSLogged{false}; if (ALSCallSite::PassOnce(bALSLogged)) { Macro(__VA_ARGS__); } } while (0)
+
+#define LogEveryN(N, Macro, ...) do { static thread_local uint32 ALSHitCount = 0; if (ALSCallSite::PassEveryN(ALSHitCount, (N))) { Macro(__VA_ARGS__); } } while (0)
+
+#define LogEveryXSeconds(Seconds, Macro, ...) do { static std::atomic<uint64> ALSNextCycles{0}; if (ALSCallSite::PassEveryXSeconds(ALSNextCycles, (Seconds))) { Macro(__VA_ARGS__); } } while (0)
+
+#define LogIf(Condition, Macro, ...) do { if (Condition) { Macro(__VA_ARGS__); } } while (0)
+
+
+
+// -- Timer Macros --  Example:- ALS_SCOPE_TIMER(UpdatePathing);  or  ALS_TIMER_BEGIN(Spawn); ... ALS_TIMER_END(Spawn);
+// Each call site keeps a lock free histogram, summarized into the log once per Summary Interval instead of once per hit
+//----------------------------------------------------------------------------------------------------------------------
+
+#define ALS_SCOPE_TIMER(Name) static FALSTimerHistogram ALSTimerHistogram_##Name(TEXT(#Name), SOURCE_ID); FALSScopeTimer ALSScopeTimer_##Name(ALSTimerHistogram_##Name)
+
+#define ALS_TIMER_BEGIN(Name) static FALSTimerHistogram ALSTimerHistogram_##Name(TEXT(#Name), SOURCE_ID); const uint64 ALSTimerStart_##Name = FPlatformTime::Cycles64()
+
+#define ALS_TIMER_END(Name) ALSTimerHistogram_##Name.AddCycles(FPlatformTime::Cycles64() - ALSTimerStart_##Name)
+
+
+
+// -- Metric Macros --  Example:- ALS_COUNTER_ADD(EnemiesSpawned, 1);  ALS_GAUGE_SET(AliveEnemies, Enemies.Num());
+// Counts and levels without a string per event. Written as one metrics record per Summary Interval, graphable in the Logs Viewer
+//----------------------------------------------------------------------------------------------------------------------
+
+#define ALS_COUNTER_ADD(Name, N) do { static const int32 ALSMetricId = FALSMetrics::RegisterMetric(TEXT(#Name), EALSMetricType::Counter); FALSMetrics::AddCounter(ALSMetricId, (N)); } while (0)
+
+#define ALS_GAUGE_SET(Name, V) do { static const int32 ALSMetricId = FALSMetrics::RegisterMetric(TEXT(#Name), EALSMetricType::Gauge); FALSMetrics::SetGauge(ALSMetricId, (V)); } while (0)
+
+
+
 // -- CUSTOM MACROS --  Example:- JustPrint(FColor::Blue, "Your Message From Static Function");
 //----------------------------------------------------------------------------------------------------------------------
 
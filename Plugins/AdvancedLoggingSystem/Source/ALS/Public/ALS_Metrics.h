@@ -0,0 +1,83 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+enum class EALSMetricType : uint8
+{
+    Counter,
+    Gauge
+};
+
+// One value of a metrics summary record
+struct FALSMetricSample
+{
+    FString Name;
+    EALSMetricType Type = EALSMetricType::Counter;
+    double Value = 0.0;
+};
+
+/**
+ * Counters and gauges written by ALS_COUNTER_ADD and ALS_GAUGE_SET. Every thread writes only its own shard, so an update is a plain load and store
+ * with no contention. Once per SummaryInterval the shards are folded into one summary record: counters as the delta since the last record, gauges as the latest value.
+ */
+class ALS_API FALSMetrics
+{
+public:
+    static constexpr int32 MaxMetrics = 256;
+    static constexpr const TCHAR* SummaryCaller = TEXT("[ALS Metrics]");
+
+    // Same name returns the same id from any call site. INDEX_NONE once MaxMetrics names are taken
+    static int32 RegisterMetric(const TCHAR* Name, EALSMetricType Type);
+
+    static void AddCounter(int32 MetricId, int64 Delta);
+    static void SetGauge(int32 MetricId, double Value);
+
+    static void StartSummaries();
+    static void StopSummaries();
+
+    // One record with every counter that changed and every gauge that was set since the last flush
+    static void FlushSummaries();
+
+    // "counter Spawned 120 | gauge AliveEnemies 37.000"
+    static bool ParseSummary(const FString& Message, TArray<FALSMetricSample>& OutSamples);
+
+private:
+    struct FShard
+    {
+        FShard();
+
+        // Running totals, never reset, the flush takes the difference
+        std::atomic<int64> Counters[MaxMetrics];
+
+        // Cycles64 of the last set, the newest one across shards wins
+        std::atomic<uint64> GaugeStamps[MaxMetrics];
+        std::atomic<double> Gauges[MaxMetrics];
+    };
+
+    struct FMetricInfo
+    {
+        FString Name;
+        EALSMetricType Type = EALSMetricType::Counter;
+        int64 FlushedTotal = 0;
+        uint64 FlushedStamp = 0;
+    };
+
+    // Owned by a thread_local handle, folded into RetiredShard when its thread exits
+    struct FShardHandle
+    {
+        FShard* Shard = nullptr;
+        ~FShardHandle();
+    };
+
+    static FShard& GetShard();
+
+    static inline FCriticalSection RegistryLock;
+    static inline TArray<FMetricInfo> Metrics;
+    static inline TArray<FShard*> Shards;
+    static inline FShard RetiredShard;
+    static inline FTSTicker::FDelegateHandle SummaryTickerHandle;
+};
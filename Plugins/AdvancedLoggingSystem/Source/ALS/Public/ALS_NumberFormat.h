@@ -0,0 +1,24 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Formats numbers straight into a builder. Integers are written two digits at a time, floats are scaled to a fixed point integer first, so neither goes through the printf parser
+class ALS_API FALSNumberFormat
+{
+public:
+    // Matches "%f"
+    static constexpr int32 DefaultPrecision = 6;
+    static constexpr int32 MaxPrecision = 9;
+
+    static void AppendInt(FStringBuilderBase& OutBuilder, int64 Value);
+
+    static void AppendUInt(FStringBuilderBase& OutBuilder, uint64 Value);
+
+    // Same digits as a correctly rounded "%.<Precision>f". Values too large for the fixed point path, NaN and infinity fall back to Appendf
+    static void AppendFixed(FStringBuilderBase& OutBuilder, double Value, int32 Precision = DefaultPrecision);
+
+    // Appends each label followed by its value, {"X: ", ", Y: "} and {1, 2} gives "X: 1.000000, Y: 2.000000"
+    static void AppendComponents(FStringBuilderBase& OutBuilder, std::initializer_list<const TCHAR*> Labels, std::initializer_list<double> Values, int32 Precision = DefaultPrecision);
+};
@@ -0,0 +1,53 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ALS_ScreenLog.generated.h"
+
+class UCanvas;
+class APlayerController;
+
+// One on-screen line, identical prints from the same source are folded into it
+struct FALSScreenLine
+{
+    uint32 LineKey = 0;
+    bool bKeyed = false;
+    FString Text;
+    FString DisplayText;
+    FColor Color = FColor::White;
+    double ExpireTime = 0.0;
+    int32 Count = 1;
+    bool bDrawn = false;
+};
+
+// Screen prints of a game world. Replaces one engine debug message per print with a capped list of coalesced lines drawn in a single canvas pass
+UCLASS()
+class ALS_API UALS_ScreenLogSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Returns false if the context has no screen log, the caller then falls back to GEngine->AddOnScreenDebugMessage
+    static bool AddMessage(
+        const UObject* Context,
+        const FString& SourceID,
+        const FString& Text,
+        const FName& Key,
+        float Duration,
+        const FColor& Color
+    );
+
+private:
+    void AddLine(uint32 LineKey, bool bKeyed, const FString& Text, float Duration, const FColor& Color);
+    void DrawLines(UCanvas* Canvas, APlayerController* PlayerController);
+
+    // Newest first, never longer than MaxScreenLines
+    TArray<FALSScreenLine> Lines;
+    FDelegateHandle DrawHandle;
+};
@@ -24,6 +24,7 @@ public:
     static FPrintConfig GetConfigFromPreset(EPrintPreset Preset);
     static bool IsFileLoggingAllowed();
     static bool IsPropertyInspectorAllowed();
+    static bool IsSeverityStrippedInCook(ELogSeverity Severity);
 
     // If true, includes the caller's context name (e.g. [MyActor]) before the print message
     UPROPERTY(Config, EditDefaultsOnly, Category = "GENERAL SETTINGS", meta = (DisplayName = "Show Context Name"))
@@ -37,6 +38,24 @@ public:
     UPROPERTY(Config, EditDefaultsOnly, Category = "GENERAL SETTINGS", meta = (DisplayName = "Enable PropertyInspector In Shipping"))
     bool bEnableInspectorInShipping = false;
 
+    // Most lines the ALS screen log shows at once. Repeated prints from the same source are counted on one line instead of stacking
+    UPROPERTY(Config, EditDefaultsOnly, Category = "GENERAL SETTINGS", meta = (DisplayName = "Max Screen Lines", ClampMin = "1", ClampMax = "200"))
+    int32 MaxScreenLines = 30;
+
+    // World space prints (Print3D) further than this from the camera are not drawn. 0 draws them at any distance
+    UPROPERTY(Config, EditDefaultsOnly, Category = "GENERAL SETTINGS", meta = (DisplayName = "Max World Text Distance", ClampMin = "0.0", Units = "cm"))
+    float MaxWorldTextDistance = 15000.0f;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+    // When enabled, ALS nodes whose Log Level is below the minimum are compiled out of cooked Blueprints. Nodes with a connected Log Level pin are always kept
+    UPROPERTY(Config, EditDefaultsOnly, Category = "COOK SETTINGS", meta = (DisplayName = "Strip Low Severity Nodes In Cook"))
+    bool bStripNodesInCook = false;
+
+    // Lowest Log Level an ALS node needs to survive the cook
+    UPROPERTY(Config, EditDefaultsOnly, Category = "COOK SETTINGS", meta = (DisplayName = "Minimum Cooked Severity", EditCondition = "bStripNodesInCook"))
+    ELogSeverity MinimumCookedSeverity = ELogSeverity::Warning;
+
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
     /** What chord opens/closes the Logs Viewer */
@@ -100,6 +119,44 @@ public:
         meta = (DisplayName = "Archive Logs Older Than (Days)", ClampMin = "1", ClamALSx = "365"))
         int32 MaxFileLogAge = 3;
 
+    // A running instance rolls over to a new segment file ("<Instance>.0001.log", ...) once the current one reaches this size. The Logs Viewer reads all segments as one log. 0 disables
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER",
+        meta = (DisplayName = "Log Segment Size (MB)", ClampMin = "0", UIMax = "1024"))
+        int32 LogSegmentSize = 8;
+
+    // Also rolls over to a new segment after this many minutes of writing to the same one. 0 disables
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER",
+        meta = (DisplayName = "Log Segment Duration (Minutes)", ClampMin = "0", UIMax = "1440"))
+        int32 LogSegmentDuration = 0;
+
+    // Consecutive identical messages from one call site are written once, followed by a single "repeated N times" record when the run ends
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER", meta = (DisplayName = "Collapse Repeated Messages"))
+    bool bCollapseRepeatedMessages = true;
+
+    // A run still open this long after its first message is written out, so idle runs and crashes lose at most this much of a count
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER",
+        meta = (DisplayName = "Repeat Flush Interval (Seconds)", ClampMin = "1", UIMax = "600", EditCondition = "bCollapseRepeatedMessages"))
+        float RepeatFlushInterval = 5.0f;
+
+    // A run is written out once it has collapsed this many repeats, even while they keep coming
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER",
+        meta = (DisplayName = "Max Collapsed Repeats", ClampMin = "1", EditCondition = "bCollapseRepeatedMessages"))
+        int32 MaxCollapsedRepeats = 10000;
+
+    // Timers (ALS_SCOPE_TIMER) and metrics (ALS_COUNTER_ADD, ALS_GAUGE_SET) are aggregated in memory and written as summary records once per interval
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER",
+        meta = (DisplayName = "Summary Interval (Seconds)", ClampMin = "1", UIMax = "600"))
+        float SummaryInterval = 10.0f;
+
+    // Archived logs are compressed in the background, the Logs Viewer reads them back transparently
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER", meta = (DisplayName = "Compress Archived Logs"))
+    bool bCompressArchivedLogs = true;
+
+    // Oldest archived logs are deleted once the ArchivedLogs directory grows past this size. 0 keeps everything
+    UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER",
+        meta = (DisplayName = "Archived Logs Quota (MB)", ClampMin = "0", UIMax = "10240"))
+        int32 MaxArchivedLogsSize = 1024;
+
     // Enabling this will list all the archived logs from the ArchivedLogs directory.
     UPROPERTY(Config, EditDefaultsOnly, Category = "LOG VIEWER", meta = (DisplayName = "Access Archived Logs in Viewer"))
     bool bIncludeArchivedLogsInViewer = false;
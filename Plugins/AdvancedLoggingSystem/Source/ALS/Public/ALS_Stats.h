@@ -0,0 +1,45 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// "stat ALS" on any running instance, and the ALS category in CSV captures (csvprofile start)
+DECLARE_STATS_GROUP(TEXT("ALS"), STATGROUP_ALS, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PrintALS"), STAT_ALS_Print, STATGROUP_ALS, ALS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DrawALS"), STAT_ALS_Draw, STATGROUP_ALS, ALS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Format Arguments"), STAT_ALS_Format, STATGROUP_ALS, ALS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Write File Record"), STAT_ALS_FileWrite, STATGROUP_ALS, ALS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Property Inspector Tick"), STAT_ALS_InspectorTick, STATGROUP_ALS, ALS_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Messages"), STAT_ALS_Messages, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("File Records"), STAT_ALS_FileRecords, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("File Bytes Written"), STAT_ALS_FileBytes, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Screen Prints Coalesced"), STAT_ALS_ScreenCoalesced, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Screen Lines Dropped"), STAT_ALS_ScreenDropped, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Inspector Subscriptions Ticked"), STAT_ALS_InspectorTicked, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Inspector Subscriptions Skipped"), STAT_ALS_InspectorSkipped, STATGROUP_ALS, ALS_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Screen Lines"), STAT_ALS_ScreenLines, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("World Text Slots"), STAT_ALS_WorldTextSlots, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("File Queue Depth"), STAT_ALS_FileQueueDepth, STATGROUP_ALS, ALS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Screen Prints"), STAT_ALS_PendingScreenPrints, STATGROUP_ALS, ALS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("World Text Memory"), STAT_ALS_WorldTextMemory, STATGROUP_ALS, ALS_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, ALS);
+
+// Per frame count that goes to both "stat ALS" and the CSV profiler
+#define ALS_STAT_ADD(StatName, Amount) \
+    do \
+    { \
+        INC_DWORD_STAT_BY(STAT_ALS_##StatName, Amount); \
+        CSV_CUSTOM_STAT(ALS, StatName, static_cast<int32>(Amount), ECsvCustomStatOp::Accumulate); \
+    } while (0)
+
+// Timed scope that goes to both "stat ALS" and the CSV profiler
+#define ALS_STAT_SCOPE(StatName) \
+    SCOPE_CYCLE_COUNTER(STAT_ALS_##StatName); \
+    CSV_SCOPED_TIMING_STAT(ALS, StatName)
@@ -0,0 +1,16 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Formats log times for display. The per-second part is cached per thread, only the milliseconds are patched in
+class ALS_API FALSTimeFormat
+{
+public:
+    // "dd:mm:YYYY HH:MM:SS"
+    static const FString& FormatDateTime(const FDateTime& Time);
+
+    // "HH:MM:SS" or "HH:MM:SS:mmm"
+    static void AppendTimeOfDay(const FDateTime& Time, bool bWithMilliseconds, FStringBuilderBase& OutBuilder);
+};
@@ -0,0 +1,93 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ALS_Definitions.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+// Lock free latency histogram of one timer call site. Buckets are log-linear, 8 per power of two, so any value is off by at most 1/16 of itself
+class ALS_API FALSTimerHistogram
+{
+public:
+    static constexpr int32 SubBucketBits = 3;
+    static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+
+    // Up to 2^42 ns (about 73 minutes), longer samples land in the last bucket
+    static constexpr int32 MaxExponent = 42;
+    static constexpr int32 NumBuckets = (MaxExponent - SubBucketBits + 2) * SubBucketCount;
+
+    FALSTimerHistogram(const TCHAR* InName, const FString& InSourceID);
+    ~FALSTimerHistogram();
+
+    FALSTimerHistogram(const FALSTimerHistogram&) = delete;
+    FALSTimerHistogram& operator=(const FALSTimerHistogram&) = delete;
+
+    void AddNs(uint64 Ns);
+
+    FORCEINLINE void AddCycles(uint64 Cycles)
+    {
+        AddNs(static_cast<uint64>(Cycles * FPlatformTime::GetSecondsPerCycle64() * 1e9));
+    }
+
+    // Takes everything recorded since the last call and starts over. False when nothing was recorded
+    bool TakeSummary(FTimerSummaryEntries& OutSummary);
+
+    const TCHAR* GetName() const { return Name; }
+    const FString& GetSourceID() const { return SourceID; }
+
+    static int32 GetBucketIndex(uint64 Ns);
+    static uint64 GetBucketLowerBound(int32 BucketIndex);
+
+private:
+    const TCHAR* Name;
+    FString SourceID;
+
+    std::atomic<uint64> Buckets[NumBuckets];
+    std::atomic<uint64> SumNs{0};
+    std::atomic<uint64> MinNs{MAX_uint64};
+    std::atomic<uint64> MaxNs{0};
+};
+
+// Records the time between construction and destruction
+class FALSScopeTimer
+{
+public:
+    explicit FALSScopeTimer(FALSTimerHistogram& InHistogram)
+        : Histogram(InHistogram)
+        , StartCycles(FPlatformTime::Cycles64())
+    {}
+
+    ~FALSScopeTimer()
+    {
+        Histogram.AddCycles(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+private:
+    FALSTimerHistogram& Histogram;
+    uint64 StartCycles;
+};
+
+// Keeps every timer call site and writes their summaries into the ALS log once per SummaryInterval
+class ALS_API FALSTimers
+{
+public:
+    static void Register(FALSTimerHistogram* Histogram);
+    static void Unregister(FALSTimerHistogram* Histogram);
+
+    static void StartSummaries();
+    static void StopSummaries();
+
+    // One summary record per timer that was hit since the last flush
+    static void FlushSummaries();
+
+    // "Name | count 12 | min 0.010 ms | p50 0.020 ms | p99 0.100 ms | max 0.120 ms | mean 0.030 ms"
+    static void AppendSummary(FStringBuilderBase& OutBuilder, const FTimerSummaryEntries& Summary);
+    static bool ParseSummary(const FString& Message, FTimerSummaryEntries& OutSummary);
+
+private:
+    static inline FCriticalSection RegistryLock;
+    static inline TArray<FALSTimerHistogram*> Histograms;
+    static inline FTSTicker::FDelegateHandle SummaryTickerHandle;
+};
@@ -0,0 +1,32 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ALS_Definitions.h"
+
+#if !defined(ALS_TRACE_ENABLED)
+    #define ALS_TRACE_ENABLED UE_TRACE_ENABLED
+#endif
+
+#if ALS_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(ALSChannel, ALS_API)
+#endif
+
+// Emits ALS messages to Unreal Insights on the "ALS" trace channel. Call sites and contexts are sent once as ids, every message after that is a small binary event
+class ALS_API FALSTrace
+{
+public:
+    static void OutputMessage(const FString& SourceID, const FString& Caller, ELogSeverity LogSeverity, const FString& InMessage);
+
+    static bool IsEnabled();
+
+private:
+    static uint32 GetCallSiteId(const FString& SourceID);
+    static uint32 GetContextId(const FString& Caller);
+};
+
+// CPU scope that shows up under the ALS name in Insights timing view
+#define ALS_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE(ALS_##Name)
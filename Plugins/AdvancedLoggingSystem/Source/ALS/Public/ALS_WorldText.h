@@ -0,0 +1,76 @@
+﻿//Copyright © 2025 RTerofer. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ALS_WorldText.generated.h"
+
+class UCanvas;
+class APlayerController;
+
+// A world text slot is owned by one print site drawing for one object
+struct FALSWorldTextKey
+{
+    FString SourceID;
+    TWeakObjectPtr<const UObject> Target;
+
+    bool operator==(const FALSWorldTextKey& Other) const
+    {
+        return Target == Other.Target && SourceID == Other.SourceID;
+    }
+
+    friend uint32 GetTypeHash(const FALSWorldTextKey& Key)
+    {
+        return HashCombine(GetTypeHash(Key.SourceID), GetTypeHash(Key.Target));
+    }
+};
+
+struct FALSWorldTextSlot
+{
+    FALSWorldTextKey Key;
+
+    // Followed every frame when set, Location is then an offset from it
+    TWeakObjectPtr<const UObject> Anchor;
+    bool bHasAnchor = false;
+    FVector Location = FVector::ZeroVector;
+
+    FString Text;
+    FColor Color = FColor::White;
+    double ExpireTime = 0.0;
+    bool bDrawn = false;
+    bool bInUse = false;
+};
+
+// World space prints of a game world. Each (SourceID, object) pair keeps one pooled slot that is updated in place, and all visible slots are drawn in a single canvas pass
+UCLASS()
+class ALS_API UALS_WorldTextSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Returns false if the world has no world text renderer, the caller then falls back to DrawDebugString
+    static bool AddText(
+        UWorld* World,
+        const UObject* Target,
+        const UObject* Anchor,
+        const FVector& Location,
+        const FString& SourceID,
+        const FString& Text,
+        float Duration,
+        const FColor& Color
+    );
+
+private:
+    void ReleaseSlot(int32 SlotIndex);
+    void DrawSlots(UCanvas* Canvas, APlayerController* PlayerController);
+
+    TArray<FALSWorldTextSlot> Slots;
+    TArray<int32> FreeSlots;
+    TMap<FALSWorldTextKey, int32> SlotIndices;
+    FDelegateHandle DrawHandle;
+};
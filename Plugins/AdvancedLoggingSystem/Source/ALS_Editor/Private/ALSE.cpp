@@ -26,12 +26,22 @@
 #include "K2Node_CallFunction.h"
 #include "Kismet/GameplayStatics.h"
 #include "ISettingsModule.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Kismet2/BlueprintCompilationManager.h"
+#include "FileHelpers.h"
 
 static const FName ALSEditorTabName("ALSEditor");
 #define LOCTEXT_NAMESPACE "FALSEditorModule"
 
 FDelegateHandle BeginPIEDelegateHandle;
 
+// Asset registry tags written on every Blueprint save, so the ALS window only loads Blueprints saved before they existed
+static const FName ALSNodeCountTag("ALSNodeCount");
+static const FName ALSEnabledCountTag("ALSEnabledCount");
+static const FName ALSPrintModesTag("ALSPrintModes");
+static const FName ALSSeveritiesTag("ALSSeverities");
+static const FName ALSPresetsTag("ALSPresets");
+
 static FText GetOutputModeText(EPrintMode Mode)
 {
     switch (Mode)
@@ -56,6 +66,9 @@ static FText GetLogSeverityText(ELogSeverity Mode)
 
 void FALSEditorModule::StartupModule()
 {
+    // Registered before the commandlet check so resave commandlets tag Blueprints too
+    RegistryTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&FALSEditorModule::AddALSRegistryTags);
+
     if (!GIsEditor || IsRunningGame() || IsRunningCommandlet()) return;
    
     // Node registration
@@ -134,6 +147,9 @@ void FALSEditorModule::StartupModule()
 
 void FALSEditorModule::ShutdownModule()
 {
+    UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(RegistryTagsHandle);
+    RegistryTagsHandle.Reset();
+
     if (!GIsEditor || IsRunningGame() || IsRunningCommandlet()) return;
 
     PendingCheckedStateALS.Empty();
@@ -216,7 +232,7 @@ void FALSEditorModule::ShowBlueprintWindowForALS()
     TArray<FAssetData> ALSBlueprints;
     GetBlueprintsWithALSNodes(ALSBlueprints);
 
-    if (ALSBlueprints.IsEmpty())
+    if (ALSBlueprints.IsEmpty() && UntaggedALSBlueprints.IsEmpty())
     {
         FMessageDialog::Open(EAppMsgType::Ok, FText::FromString
         ("No ALS nodes detected across Project Blueprints\nAdd one to a Blueprint and reopen this window to manage ALS nodes."));
@@ -260,6 +276,7 @@ void FALSEditorModule::ShowBlueprintWindowForALS()
 
     PrintModeRowCache.Empty();
     LogSeverityRowCache.Empty();
+    ListedALSBlueprints = ALSBlueprints;
 
     ALSScrollContainer = SNew(SScrollBox);
     for (const FAssetData& Blueprint : ALSBlueprints)
@@ -271,6 +288,8 @@ void FALSEditorModule::ShowBlueprintWindowForALS()
     }
 
     MainBox->AddSlot().FillHeight(1.f).Padding(5)[ALSScrollContainer.ToSharedRef()];
+    MainBox->AddSlot().AutoHeight().Padding(5)[CreateUntaggedNotice()];
+    MainBox->AddSlot().AutoHeight().Padding(5)[CreateALSBulkBar()];
 
     ExistingALSWindow->SetOnWindowClosed(FOnWindowClosed::CreateLambda([this](const TSharedRef<SWindow>& Window)
         {
@@ -421,31 +440,26 @@ TSharedRef<SWidget> FALSEditorModule::CreateALSRow(const FAssetData& Blueprint,
      return RowWidget;
 }
 
-void FALSEditorModule::GetBlueprintsWithALSNodes(TArray<FAssetData>& OutBlueprints) const
+void FALSEditorModule::GetBlueprintsWithALSNodes(TArray<FAssetData>& OutBlueprints)
 {
-    auto BlueprintContainsALS = [](const FAssetData& BlueprintAsset) -> bool
+    auto BlueprintContainsALS = [this](const FAssetData& BlueprintAsset) -> bool
         {
-            UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintAsset.GetAsset());
-            if (!Blueprint) return false;
-
-            TArray<UEdGraph*> AllGraphs;
-            Blueprint->GetAllGraphs(AllGraphs);
-
-            for (UEdGraph* Graph : AllGraphs)
+            FALSBlueprintSummary Summary;
+            if (!GetALSSummary(BlueprintAsset, Summary))
             {
-                for (UEdGraphNode* Node : Graph->Nodes)
-                {
-                    if (Cast<UALS_Node>(Node))
-                    {
-                        return true;
-                    }
-                }
+                UntaggedALSBlueprints.Add(BlueprintAsset);
+                return false;
             }
 
-            return false;
+            if (Summary.NodeCount == 0) return false;
+
+            ListedALSSummaries.Add(BlueprintAsset, MoveTemp(Summary));
+            return true;
         };
 
     OutBlueprints.Empty();
+    ListedALSSummaries.Empty();
+    UntaggedALSBlueprints.Empty();
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (World && World->PersistentLevel)
@@ -484,125 +498,162 @@ void FALSEditorModule::GetBlueprintsWithALSNodes(TArray<FAssetData>& OutBlueprin
 
 EPrintMode FALSEditorModule::GetBlueprintALSOutputMode(const FAssetData& BlueprintAsset) const
 {
-    UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintAsset.GetAsset());
-    if (!Blueprint) return EPrintMode::ScreenAndLog;
+    const FALSBlueprintSummary* Summary = ListedALSSummaries.Find(BlueprintAsset);
+    if (!Summary || Summary->PrintModes.IsEmpty()) return EPrintMode::ScreenAndLog;
+
+    // Check for consistency
+    return Summary->PrintModes.Num() == 1 ? Summary->PrintModes[0] : (EPrintMode)0xFF;
+}
+
+ELogSeverity FALSEditorModule::GetBlueprintALSLogSeverity(const FAssetData& BlueprintAsset) const
+{
+    const FALSBlueprintSummary* Summary = ListedALSSummaries.Find(BlueprintAsset);
+    if (!Summary || Summary->LogSeverities.IsEmpty()) return ELogSeverity::Info;
+
+    // Check for consistency
+    return Summary->LogSeverities.Num() == 1 ? Summary->LogSeverities[0] : (ELogSeverity)0xFF;
+}
+
+ECheckBoxState FALSEditorModule::GetBlueprintALSCheckedState(const FAssetData& BlueprintAsset) const
+{
+    const FALSBlueprintSummary* Summary = ListedALSSummaries.Find(BlueprintAsset);
+    if (!Summary || Summary->NodeCount == 0)
+        return ECheckBoxState::Undetermined;
+
+    if (Summary->EnabledCount == Summary->NodeCount)   return ECheckBoxState::Checked;
+    if (Summary->EnabledCount == 0)                    return ECheckBoxState::Unchecked;
+
+    return ECheckBoxState::Undetermined;
+}
+
+void FALSEditorModule::BuildALSSummary(const UBlueprint* Blueprint, FALSBlueprintSummary& OutSummary)
+{
+    OutSummary = FALSBlueprintSummary();
+    if (!Blueprint) return;
 
     TArray<UEdGraph*> AllGraphs;
     Blueprint->GetAllGraphs(AllGraphs);
 
-    TArray<EPrintMode> FoundModes;
     UEnum* OutputEnum = StaticEnum<EPrintMode>();
+    UEnum* LevelEnum = StaticEnum<ELogSeverity>();
 
     for (UEdGraph* Graph : AllGraphs)
     {
         for (UEdGraphNode* Node : Graph->Nodes)
         {
-            if (UALS_Node* PNode = Cast<UALS_Node>(Node))
-            {
-                UEdGraphPin* OutputPin = PNode->FindPinById(PNode->PrintModePinId);
-                if (!OutputPin) continue;
+            UALS_Node* PNode = Cast<UALS_Node>(Node);
+            if (!PNode) continue;
+
+            OutSummary.NodeCount++;
+            if (PNode->bToggleNode) OutSummary.EnabledCount++;
+            OutSummary.Presets.AddUnique(PNode->PrintPreset);
 
+            if (UEdGraphPin* OutputPin = PNode->FindPinById(PNode->PrintModePinId))
+            {
                 const int64 EnumValue = OutputEnum->GetValueByNameString(PNode->GetSavedDefaultValue(OutputPin));
                 if (EnumValue != INDEX_NONE)
                 {
-                    FoundModes.Add(static_cast<EPrintMode>(EnumValue));
+                    OutSummary.PrintModes.AddUnique(static_cast<EPrintMode>(EnumValue));
                 }
             }
-        }
-    }
 
-    if (FoundModes.IsEmpty()) return EPrintMode::ScreenAndLog;
-
-    // Check for consistency
-    const EPrintMode FirstMode = FoundModes[0];
-    for (EPrintMode Mode : FoundModes)
-    {
-        if (Mode != FirstMode)
-        {
-            return (EPrintMode)0xFF;
+            if (UEdGraphPin* LevelPin = PNode->FindPinById(PNode->LogSeverityPinId))
+            {
+                const int64 EnumValue = LevelEnum->GetValueByNameString(PNode->GetSavedDefaultValue(LevelPin));
+                if (EnumValue != INDEX_NONE)
+                {
+                    OutSummary.LogSeverities.AddUnique(static_cast<ELogSeverity>(EnumValue));
+                }
+            }
         }
     }
-    return FirstMode;
 }
 
-ELogSeverity FALSEditorModule::GetBlueprintALSLogSeverity(const FAssetData& BlueprintAsset) const
+bool FALSEditorModule::GetALSSummary(const FAssetData& BlueprintAsset, FALSBlueprintSummary& OutSummary)
 {
-    UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintAsset.GetAsset());
-    if (!Blueprint) return ELogSeverity::Info;
+    // Loaded Blueprints may have unsaved edits, so they are read directly
+    if (const UBlueprint* LoadedBlueprint = Cast<UBlueprint>(BlueprintAsset.FastGetAsset(false)))
+    {
+        BuildALSSummary(LoadedBlueprint, OutSummary);
+        return true;
+    }
 
-    TArray<UEdGraph*> AllGraphs;
-    Blueprint->GetAllGraphs(AllGraphs);
+    OutSummary = FALSBlueprintSummary();
 
-    TArray<ELogSeverity> FoundModes;
-    UEnum* OutputEnum = StaticEnum<ELogSeverity>();
+    // Every saved Blueprint carries the count, even 0. Assets saved before the tags existed are left to TagUntaggedBlueprints
+    FString TagValue;
+    if (!BlueprintAsset.GetTagValue(ALSNodeCountTag, TagValue))
+    {
+        return false;
+    }
+    OutSummary.NodeCount = FCString::Atoi(*TagValue);
 
-    for (UEdGraph* Graph : AllGraphs)
+    if (BlueprintAsset.GetTagValue(ALSEnabledCountTag, TagValue))
     {
-        for (UEdGraphNode* Node : Graph->Nodes)
+        OutSummary.EnabledCount = FCString::Atoi(*TagValue);
+    }
+
+    auto ParseEnumList = [&BlueprintAsset](FName Tag, UEnum* Enum)
         {
-            if (UALS_Node* PNode = Cast<UALS_Node>(Node))
+            TArray<int64> Values;
+
+            FString ListValue;
+            if (BlueprintAsset.GetTagValue(Tag, ListValue))
             {
-                UEdGraphPin* OutputPin = PNode->FindPinById(PNode->LogSeverityPinId);
-                if (!OutputPin) continue;
+                TArray<FString> Names;
+                ListValue.ParseIntoArray(Names, TEXT(","));
 
-                const int64 EnumValue = OutputEnum->GetValueByNameString(PNode->GetSavedDefaultValue(OutputPin));
-                if (EnumValue != INDEX_NONE)
+                for (const FString& Name : Names)
                 {
-                    FoundModes.Add(static_cast<ELogSeverity>(EnumValue));
+                    const int64 EnumValue = Enum->GetValueByNameString(Name);
+                    if (EnumValue != INDEX_NONE)
+                    {
+                        Values.AddUnique(EnumValue);
+                    }
                 }
             }
-        }
-    }
-
-    if (FoundModes.IsEmpty()) return ELogSeverity::Info;
+            return Values;
+        };
 
-    // Check for consistency
-    const ELogSeverity FirstMode = FoundModes[0];
-    for (ELogSeverity Mode : FoundModes)
+    for (int64 Value : ParseEnumList(ALSPrintModesTag, StaticEnum<EPrintMode>()))
     {
-        if (Mode != FirstMode)
-        {
-            return (ELogSeverity)0xFF;
-        }
+        OutSummary.PrintModes.Add(static_cast<EPrintMode>(Value));
+    }
+    for (int64 Value : ParseEnumList(ALSSeveritiesTag, StaticEnum<ELogSeverity>()))
+    {
+        OutSummary.LogSeverities.Add(static_cast<ELogSeverity>(Value));
     }
-    return FirstMode;
+    for (int64 Value : ParseEnumList(ALSPresetsTag, StaticEnum<EPrintPreset>()))
+    {
+        OutSummary.Presets.Add(static_cast<EPrintPreset>(Value));
+    }
+    return true;
 }
 
-ECheckBoxState FALSEditorModule::GetBlueprintALSCheckedState(const FAssetData& BlueprintAsset) const
+void FALSEditorModule::AddALSRegistryTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
 {
-    UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintAsset.GetAsset());
-    if (!Blueprint) return ECheckBoxState::Undetermined;
+    const UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+    if (!Blueprint) return;
 
-    TArray<UALS_Node*> Nodes;
-    TArray<UEdGraph*> AllGraphs;
-    Blueprint->GetAllGraphs(AllGraphs);
+    FALSBlueprintSummary Summary;
+    BuildALSSummary(Blueprint, Summary);
 
-    for (UEdGraph* Graph : AllGraphs)
-    {
-        for (UEdGraphNode* Node : Graph->Nodes)
+    auto JoinEnumList = [](UEnum* Enum, const auto& Values)
         {
-            if (UALS_Node* CustomNode = Cast<UALS_Node>(Node))
+            TStringBuilder<128> ListValue;
+            for (const auto Value : Values)
             {
-                Nodes.Add(CustomNode);
+                if (ListValue.Len() > 0) ListValue.AppendChar(TEXT(','));
+                ListValue.Append(Enum->GetNameStringByValue(static_cast<int64>(Value)));
             }
-        }
-    }
-
-    if (Nodes.Num() == 0)
-        return ECheckBoxState::Undetermined;
-
-    bool bAllEnabled = true;
-    bool bAllDisabled = true;
-    for (UALS_Node* Node : Nodes)
-    {
-        if (Node->bToggleNode) bAllDisabled = false;
-        else bAllEnabled = false;
-    }
-
-    if (bAllEnabled)   return ECheckBoxState::Checked;
-    if (bAllDisabled)  return ECheckBoxState::Unchecked;
+            return FString(ListValue.ToView());
+        };
 
-    return ECheckBoxState::Undetermined;
+    OutTags.Add(UObject::FAssetRegistryTag(ALSNodeCountTag, FString::FromInt(Summary.NodeCount), UObject::FAssetRegistryTag::TT_Numerical));
+    OutTags.Add(UObject::FAssetRegistryTag(ALSEnabledCountTag, FString::FromInt(Summary.EnabledCount), UObject::FAssetRegistryTag::TT_Hidden));
+    OutTags.Add(UObject::FAssetRegistryTag(ALSPrintModesTag, JoinEnumList(StaticEnum<EPrintMode>(), Summary.PrintModes), UObject::FAssetRegistryTag::TT_Hidden));
+    OutTags.Add(UObject::FAssetRegistryTag(ALSSeveritiesTag, JoinEnumList(StaticEnum<ELogSeverity>(), Summary.LogSeverities), UObject::FAssetRegistryTag::TT_Hidden));
+    OutTags.Add(UObject::FAssetRegistryTag(ALSPresetsTag, JoinEnumList(StaticEnum<EPrintPreset>(), Summary.Presets), UObject::FAssetRegistryTag::TT_Hidden));
 }
 
 void FALSEditorModule::ApplyPendingChangesForALS(const FAssetData& BlueprintAsset)
@@ -689,6 +740,7 @@ void FALSEditorModule::ApplyPendingChangesForALS(const FAssetData& BlueprintAsse
 
     // Mark blueprint dirty, compile
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    BuildALSSummary(Blueprint, ListedALSSummaries.FindOrAdd(BlueprintAsset));
 
     // Remove from maps if needed
     if (bHasCheckChange)  PendingCheckedStateALS.Remove(BlueprintAsset);
@@ -749,10 +801,14 @@ void FALSEditorModule::DeleteALSNode(const FAssetData& BlueprintAsset)
 
 void FALSEditorModule::RefreshALSContainer()
 {
+    // Bulk edits refresh once when they are done
+    if (bBulkEditInProgress || !ALSScrollContainer.IsValid()) return;
+
     ALSScrollContainer->ClearChildren();
 
     TArray<FAssetData> ALSBlueprints;
     GetBlueprintsWithALSNodes(ALSBlueprints);
+    ListedALSBlueprints = ALSBlueprints;
 
     for (const FAssetData& Blueprint : ALSBlueprints)
     {
@@ -765,6 +821,68 @@ void FALSEditorModule::RefreshALSContainer()
     return;
 }
 
+void FALSEditorModule::TagUntaggedBlueprints()
+{
+    if (UntaggedALSBlueprints.IsEmpty() || bBulkEditInProgress) return;
+
+    const float NumAssets = UntaggedALSBlueprints.Num();
+
+    FScopedSlowTask SlowTask(NumAssets * 2.0f, LOCTEXT("TagUntagged", "Tagging Blueprints"));
+    SlowTask.MakeDialog(true);
+
+    TArray<UPackage*> Packages;
+    for (const FAssetData& Asset : UntaggedALSBlueprints)
+    {
+        if (SlowTask.ShouldCancel()) break;
+
+        SlowTask.EnterProgressFrame(1.0f, FText::Format(LOCTEXT("TagLoading", "Loading {0}"), FText::FromName(Asset.AssetName)));
+
+        if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+        {
+            Packages.Add(Blueprint->GetPackage());
+        }
+    }
+
+    // Saving writes the ALS tags, loaded but unsaved Blueprints of a cancelled pass are still read directly until the editor closes
+    SlowTask.EnterProgressFrame(Packages.Num(), LOCTEXT("TagSaving", "Saving Blueprints..."));
+    UEditorLoadingAndSavingUtils::SavePackages(Packages, false);
+
+    RefreshALSContainer();
+}
+
+TSharedRef<SWidget> FALSEditorModule::CreateUntaggedNotice()
+{
+    return SNew(SHorizontalBox)
+        .Visibility_Lambda([this]() { return UntaggedALSBlueprints.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible; })
+        + SHorizontalBox::Slot().FillWidth(1.0f).Padding(10.0f, 2.0f).VAlign(VAlign_Center)
+        [
+            SNew(STextBlock)
+                .AutoWrapText(true)
+                .Text_Lambda([this]()
+                    {
+                        return FText::FromString(FString::Printf(TEXT("%d Blueprints were saved before this version and are not scanned. Tag them once to list their ALS nodes."), UntaggedALSBlueprints.Num()));
+                    })
+        ]
+        + SHorizontalBox::Slot().AutoWidth().Padding(5.0f, 2.0f)
+        [
+            SNew(SButton)
+                .Text(FText::FromString("Load and Resave"))
+                .OnClicked_Lambda([this]()
+                    {
+                        EAppReturnType::Type Result = FMessageDialog::Open(EAppMsgType::OkCancel,
+                        FText::FromString(FString::Printf(TEXT("Load and resave %d Blueprints to tag them?\n\nNOTE: This is only needed once, resaved Blueprints are listed without being loaded."), UntaggedALSBlueprints.Num())));
+
+                        if (Result == EAppReturnType::Ok)
+                        {
+                            TagUntaggedBlueprints();
+                        }
+
+                        return FReply::Handled();
+                    })
+                .ToolTipText(LOCTEXT("TagUntagged_Tooltip", "Load and resave the Blueprints saved before the ALS asset registry tags existed."))
+        ];
+}
+
 
 // Regular Manager
 void FALSEditorModule::ShowBlueprintWindowForUPS()
@@ -822,6 +940,8 @@ void FALSEditorModule::ShowBlueprintWindowForUPS()
         ];
 
 
+    ListedUPSBlueprints = RelevantBlueprints;
+
     UPSScrollContainer = SNew(SScrollBox);
     for (const FAssetData& Blueprint : RelevantBlueprints)
     {
@@ -832,6 +952,7 @@ void FALSEditorModule::ShowBlueprintWindowForUPS()
     }
 
     MainBox->AddSlot().FillHeight(1.f).Padding(5)[UPSScrollContainer.ToSharedRef()];
+    MainBox->AddSlot().AutoHeight().Padding(5)[CreateUPSBulkBar()];
 
     ExistingUPSWindow->SetOnWindowClosed(FOnWindowClosed::CreateLambda([this](const TSharedRef<SWindow>& Window)
         {
@@ -1284,10 +1405,14 @@ void FALSEditorModule::ReplaceUPSWithALS(const FAssetData& BlueprintAsset)
 
 void FALSEditorModule::RefreshUPSContainer()
 {
+    // Bulk edits refresh once when they are done
+    if (bBulkEditInProgress || !UPSScrollContainer.IsValid()) return;
+
     UPSScrollContainer->ClearChildren();
 
     TArray<FAssetData> UPSBlueprints;
     GetBlueprintsWithUPSNodes(UPSBlueprints);
+    ListedUPSBlueprints = UPSBlueprints;
 
     for (const FAssetData& Blueprint : UPSBlueprints)
     {
@@ -1301,6 +1426,179 @@ void FALSEditorModule::RefreshUPSContainer()
 }
 
 
+// Bulk Edits
+void FALSEditorModule::RunBulkEdit(const TArray<FAssetData>& BlueprintAssets, const FText& TaskTitle, TFunction<void(const FAssetData&)> EditAsset)
+{
+    if (BlueprintAssets.IsEmpty() || bBulkEditInProgress) return;
+
+    bBulkEditInProgress = true;
+
+    auto FinishBulkEdit = [this]()
+        {
+            bBulkEditInProgress = false;
+            RefreshALSContainer();
+            RefreshUPSContainer();
+        };
+
+    const float NumAssets = BlueprintAssets.Num();
+
+    // Loading, editing and compiling are weighted the same per asset
+    FScopedSlowTask SlowTask(NumAssets * 3.0f, TaskTitle);
+    SlowTask.MakeDialog(true);
+
+    TArray<FSoftObjectPath> AssetPaths;
+    for (const FAssetData& Asset : BlueprintAssets)
+    {
+        AssetPaths.Add(Asset.GetSoftObjectPath());
+    }
+
+    // Loads run on the async loading thread, the game thread only pumps progress and watches for cancel
+    TSharedPtr<FStreamableHandle> LoadHandle = BulkStreamableManager.RequestAsyncLoad(AssetPaths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+
+    float ReportedProgress = 0.0f;
+    while (LoadHandle.IsValid() && LoadHandle->IsLoadingInProgress())
+    {
+        if (SlowTask.ShouldCancel())
+        {
+            LoadHandle->CancelHandle();
+            FinishBulkEdit();
+            return;
+        }
+
+        LoadHandle->WaitUntilComplete(0.05f);
+
+        const float LoadProgress = LoadHandle->GetProgress() * NumAssets;
+        SlowTask.EnterProgressFrame(LoadProgress - ReportedProgress, LOCTEXT("BulkLoading", "Loading Blueprints..."));
+        ReportedProgress = LoadProgress;
+    }
+    SlowTask.EnterProgressFrame(NumAssets - ReportedProgress);
+
+    TArray<UBlueprint*> EditedBlueprints;
+    {
+        const FScopedTransaction Transaction(TaskTitle);
+
+        for (const FAssetData& Asset : BlueprintAssets)
+        {
+            if (SlowTask.ShouldCancel()) break;
+
+            SlowTask.EnterProgressFrame(1.0f, FText::Format(LOCTEXT("BulkEditing", "Editing {0}"), FText::FromName(Asset.AssetName)));
+
+            UBlueprint* Blueprint = Cast<UBlueprint>(Asset.FastGetAsset(false));
+            if (!Blueprint) continue;
+
+            EditAsset(Asset);
+            EditedBlueprints.Add(Blueprint);
+        }
+    }
+
+    // A cancelled run keeps its edits (undoable) and leaves them to the next regular compile
+    if (!SlowTask.ShouldCancel() && EditedBlueprints.Num() > 0)
+    {
+        SlowTask.EnterProgressFrame(EditedBlueprints.Num(), LOCTEXT("BulkCompiling", "Compiling Blueprints..."));
+
+        for (UBlueprint* Blueprint : EditedBlueprints)
+        {
+            FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+        }
+        FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+    }
+
+    LoadHandle.Reset();
+    FinishBulkEdit();
+}
+
+TSharedRef<SWidget> FALSEditorModule::CreateALSBulkBar()
+{
+    auto SetAllEnabled = [this](bool bEnabled)
+        {
+            RunBulkEdit(ListedALSBlueprints, bEnabled ? LOCTEXT("BulkEnableALS", "Enabling ALS Nodes") : LOCTEXT("BulkDisableALS", "Disabling ALS Nodes"),
+                [this, bEnabled](const FAssetData& Asset)
+                {
+                    PendingCheckedStateALS.Add(Asset, bEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked);
+                    ApplyPendingChangesForALS(Asset);
+                });
+            return FReply::Handled();
+        };
+
+    return SNew(SHorizontalBox)
+        + SHorizontalBox::Slot().FillWidth(1.0f)
+        + SHorizontalBox::Slot().AutoWidth().Padding(5.0f, 2.0f)
+        [
+            SNew(SButton)
+                .Text(FText::FromString("Enable All"))
+                .OnClicked_Lambda([SetAllEnabled]() { return SetAllEnabled(true); })
+                .ToolTipText(LOCTEXT("EnableAll_Tooltip", "Enable the ALS nodes in every listed Blueprint and compile them together."))
+        ]
+        + SHorizontalBox::Slot().AutoWidth().Padding(5.0f, 2.0f)
+        [
+            SNew(SButton)
+                .Text(FText::FromString("Disable All"))
+                .OnClicked_Lambda([SetAllEnabled]() { return SetAllEnabled(false); })
+                .ToolTipText(LOCTEXT("DisableAll_Tooltip", "Disable the ALS nodes in every listed Blueprint and compile them together."))
+        ]
+        + SHorizontalBox::Slot().AutoWidth().Padding(5.0f, 2.0f)
+        [
+            SNew(SButton)
+                .Text(FText::FromString("Delete All"))
+                .OnClicked_Lambda([this]()
+                    {
+                        EAppReturnType::Type Result = FMessageDialog::Open(EAppMsgType::OkCancel,
+                        FText::FromString(FString::Printf(TEXT("Are you sure you want to delete all ALS nodes in %d Blueprints?\n\nNOTE: Make sure to save after verifying. You can also revert this action by Undo"), ListedALSBlueprints.Num())));
+
+                        if (Result == EAppReturnType::Ok)
+                        {
+                            RunBulkEdit(ListedALSBlueprints, LOCTEXT("BulkDeleteALS", "Deleting ALS Nodes"), [this](const FAssetData& Asset) { DeleteALSNode(Asset); });
+                        }
+
+                        return FReply::Handled();
+                    })
+                .ToolTipText(LOCTEXT("DeleteAll_Tooltip", "Delete the ALS nodes in every listed Blueprint while preserving their exec chains."))
+        ];
+}
+
+TSharedRef<SWidget> FALSEditorModule::CreateUPSBulkBar()
+{
+    return SNew(SHorizontalBox)
+        + SHorizontalBox::Slot().FillWidth(1.0f)
+        + SHorizontalBox::Slot().AutoWidth().Padding(5.0f, 2.0f)
+        [
+            SNew(SButton)
+                .Text(FText::FromString("Replace All"))
+                .OnClicked_Lambda([this]()
+                    {
+                        EAppReturnType::Type Result = FMessageDialog::Open(EAppMsgType::OkCancel,
+                        FText::FromString(FString::Printf(TEXT("Are you sure you want to replace all Print String nodes in %d Blueprints with ALS?\n\nNOTE: Make sure to save after verifying. You can also revert this action by Undo"), ListedUPSBlueprints.Num())));
+
+                        if (Result == EAppReturnType::Ok)
+                        {
+                            RunBulkEdit(ListedUPSBlueprints, LOCTEXT("BulkReplaceUPS", "Replacing Print String Nodes"), [this](const FAssetData& Asset) { ReplaceUPSWithALS(Asset); });
+                        }
+
+                        return FReply::Handled();
+                    })
+                .ToolTipText(LOCTEXT("ReplaceAll_Tooltip", "Convert the Print String nodes in every listed Blueprint into ALS nodes and compile them together."))
+        ]
+        + SHorizontalBox::Slot().AutoWidth().Padding(5.0f, 2.0f)
+        [
+            SNew(SButton)
+                .Text(FText::FromString("Delete All"))
+                .OnClicked_Lambda([this]()
+                    {
+                        EAppReturnType::Type Result = FMessageDialog::Open(EAppMsgType::OkCancel,
+                        FText::FromString(FString::Printf(TEXT("Are you sure you want to delete all Print String nodes in %d Blueprints?\n\nNOTE: Make sure to save after verifying. You can also revert this action by Undo"), ListedUPSBlueprints.Num())));
+
+                        if (Result == EAppReturnType::Ok)
+                        {
+                            RunBulkEdit(ListedUPSBlueprints, LOCTEXT("BulkDeleteUPS", "Deleting Print String Nodes"), [this](const FAssetData& Asset) { DeleteUPSNode(Asset); });
+                        }
+
+                        return FReply::Handled();
+                    })
+                .ToolTipText(LOCTEXT("DeleteAllUPS_Tooltip", "Delete the Print String nodes in every listed Blueprint while preserving their exec chains."))
+        ];
+}
+
+
 //Post Undo - Redo Validation
 void FALSEditorModule::PostUndo(bool bSuccess)
 {
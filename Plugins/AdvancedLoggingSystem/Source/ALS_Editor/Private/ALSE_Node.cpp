@@ -18,7 +18,6 @@
 #include "K2Node_CallFunction.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Subsystems/EditorAssetSubsystem.h" 
-#include "K2Node_MakeArray.h"
 #include "FileHelpers.h"
 
 static int32 UpgradedVersion = 1;
@@ -669,13 +668,6 @@ bool UALS_Node::IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphP
 
     if (IsWildcardPin(MyPin))
     {
-        const int32 ConnectionCount = GetWildcardPinConnectedCount();
-        if (ConnectionCount >= 10)
-        {
-            OutReason = TEXT("Maximum of 10 connections allowed, Try to disconnect any or use ALS Append Node!");
-            return true;
-        }
-
         if (OtherPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
         {
             OutReason = TEXT("Execution pins are not allowed!");
@@ -793,37 +785,7 @@ void UALS_Node::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* So
     }
 
     TArray<UEdGraphPin*> DataPins = GetDataPins();
-    int32 NumConnected = GetWildcardPinConnectedCount();
-
-    int32 MaxValues = 0;
-    FName FunctionName = NAME_None;
-
-    if (NumConnected <= 3)
-    {
-        FunctionName = FName("PrintHelperONE");
-        MaxValues = 3;
-    }
-    else if (NumConnected <= 5)
-    {
-        FunctionName = FName("PrintHelperTWO");
-        MaxValues = 5;
-    }
-    else if (NumConnected <= 7)
-    {
-        FunctionName = FName("PrintHelperTHREE");
-        MaxValues = 7;
-    }
-    else if (NumConnected <= 10)
-    {
-        FunctionName = FName("PrintHelperFOUR");
-        MaxValues = 10;
-    }
-    else
-    {
-        CompilerContext.MessageLog.Error(TEXT("ALS: Upto 10 connected pins are allowed to compile. Disconnect additional pins. Optionally use ALS Append Node"));
-        BreakAllNodeLinks();
-        return;
-    }
+    const FName FunctionName = GET_FUNCTION_NAME_CHECKED(UALS_FunctionLibrary, PrintHelperProgram);
 
     auto SpawnHelperNode = [&](int32 ExecInt, UEdGraphPin* ThisExecIn, UEdGraphPin* ThisExecOut)
         {
@@ -957,116 +919,35 @@ void UALS_Node::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* So
                 PH_TextLocation->DefaultValue = FString::Printf(TEXT("%f, %f, %f"), TextLocationDefault.X, TextLocationDefault.Y, TextLocationDefault.Z);
             }
 
-            TArray<EPinType> Temp_PinTypes;
-            TArray<FString>  Temp_LiteralStrings;
+            // Literals are folded into the program here, only connected values are left for the runtime
+            FString FormatProgram;
 
-            Temp_PinTypes.SetNum(DataPins.Num());
-            Temp_LiteralStrings.SetNum(DataPins.Num());
+            const FString ExecLabel = GetSavedDefaultValue(ThisExecIn);
+            if (!ExecLabel.IsEmpty())
+            {
+                FALSFormatProgram::AppendLiteral(FormatProgram, FString::Printf(TEXT("[%s] "), *ExecLabel));
+            }
 
             int32 ValueIndex = 0;
 
-            for (int32 i = 0; i < DataPins.Num(); i++)
+            for (UEdGraphPin* DataPin : DataPins)
             {
-                UEdGraphPin* DataPin = DataPins[i];
-                bool bConnected = DataPin->HasAnyConnections();
-
-                if (bConnected)
-                {
-                    if (DataPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Object)
-                    {
-                        Temp_PinTypes[i] = EPinType::ObjectProperty;
-                        Temp_LiteralStrings[i] = TEXT("null");
-                    }
-                    else
-                    {
-                        Temp_PinTypes[i] = EPinType::OtherProperty;
-                        Temp_LiteralStrings[i] = TEXT("null");
-                    }
-
-                    if (ValueIndex < MaxValues)
-                    {
-                        FString ValuePinName = FString::Printf(TEXT("Value%d"), ValueIndex + 1);
-                        UEdGraphPin* PH_ValuePin = PrintHelperNode->FindPinChecked(*ValuePinName);
-
-                        PH_ValuePin->PinType = DataPin->PinType;
-                        CompilerContext.CopyPinLinksToIntermediate(*DataPin, *PH_ValuePin);
-
-                        ValueIndex++;
-                    }
-                    else
-                    {
-                        CompilerContext.MessageLog.Error(*FString::Printf(TEXT("Too many connected pins for function %s"), *FunctionName.ToString()));
-                    }
-                }
-                else
+                if (!DataPin->HasAnyConnections())
                 {
-                    Temp_PinTypes[i] = EPinType::UnConnected;
-                    Temp_LiteralStrings[i] = GetSavedDefaultValue(DataPin);
+                    FALSFormatProgram::AppendLiteral(FormatProgram, GetSavedDefaultValue(DataPin));
+                    continue;
                 }
-            }
-
-            while (ValueIndex < MaxValues)
-            {
-                FString ValuePinName = FString::Printf(TEXT("Value%d"), ValueIndex + 1);
-                UEdGraphPin* PH_ValuePin = PrintHelperNode->FindPinChecked(*ValuePinName);
-
-                PH_ValuePin->PinType.PinCategory = UEdGraphSchema_K2::PC_String;
-                PH_ValuePin->DefaultValue = TEXT("");
-
-                Temp_PinTypes.Add(EPinType::UnHandled);
-                Temp_LiteralStrings.Add(TEXT(""));
-
-                ValueIndex++;
-            }
 
-            if (!GetSavedDefaultValue(ThisExecIn).IsEmpty())
-            {
-                Temp_PinTypes.Insert(EPinType::UnConnected, 0);
-                Temp_LiteralStrings.Insert(FString::Printf(TEXT("[%s] "), *GetSavedDefaultValue(ThisExecIn)), 0);
-            }
-
-            UEdGraphPin* PH_PinTypesArray = PrintHelperNode->FindPinChecked(TEXT("PinTypes"));
-            UK2Node_MakeArray* MakePinTypesNode = CompilerContext.SpawnIntermediateNode<UK2Node_MakeArray>(this, SourceGraph);
-            MakePinTypesNode->NumInputs = Temp_PinTypes.Num();
-            MakePinTypesNode->AllocateDefaultPins();
+                const bool bObjectPin = DataPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Object;
+                FALSFormatProgram::AppendSlot(FormatProgram, bObjectPin ? EPinType::ObjectProperty : EPinType::OtherProperty);
 
-            UEdGraphPin* OutPinTypesPin = MakePinTypesNode->GetOutputPin();
-            OutPinTypesPin->PinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-            OutPinTypesPin->PinType.PinSubCategoryObject = StaticEnum<EPinType>();
-
-            for (int32 i = 0; i < Temp_PinTypes.Num(); i++)
-            {
-                UEdGraphPin* ElemPin = MakePinTypesNode->FindPinChecked(*FString::Printf(TEXT("[%d]"), i));
-                ElemPin->PinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-                ElemPin->PinType.PinSubCategoryObject = StaticEnum<EPinType>();
-
-                uint8 EnumValue = static_cast<uint8>(Temp_PinTypes[i]);
-                UEnum* EnumType = StaticEnum<EPinType>();
-                FString EnumName = EnumType->GetNameStringByValue(EnumValue);
-
-                ElemPin->DefaultValue = EnumName;
-            }
-
-            OutPinTypesPin->MakeLinkTo(PH_PinTypesArray);
-
-
-            UEdGraphPin * PH_LiteralStringsArray = PrintHelperNode->FindPinChecked(TEXT("UnConnectedValues"));
-            UK2Node_MakeArray* MakeLiteralArrayNode = CompilerContext.SpawnIntermediateNode<UK2Node_MakeArray>(this, SourceGraph);
-            MakeLiteralArrayNode->NumInputs = Temp_LiteralStrings.Num();
-            MakeLiteralArrayNode->AllocateDefaultPins();
-
-            UEdGraphPin* OutLiteralArrayPin = MakeLiteralArrayNode->GetOutputPin();
-            OutLiteralArrayPin->PinType.PinCategory = UEdGraphSchema_K2::PC_String;
-
-            for (int32 i = 0; i < Temp_LiteralStrings.Num(); i++)
-            {
-                UEdGraphPin* ElemPin = MakeLiteralArrayNode->FindPinChecked(*FString::Printf(TEXT("[%d]"), i));
-                ElemPin->PinType.PinCategory = UEdGraphSchema_K2::PC_String;
-                ElemPin->DefaultValue = Temp_LiteralStrings[i];
+                FString ValuePinName = FString::Printf(TEXT("Value%d"), ++ValueIndex);
+                UEdGraphPin* PH_ValuePin = PrintHelperNode->CreatePin(EGPD_Input, DataPin->PinType, *ValuePinName);
+                CompilerContext.CopyPinLinksToIntermediate(*DataPin, *PH_ValuePin);
             }
 
-            OutLiteralArrayPin->MakeLinkTo(PH_LiteralStringsArray);
-                
+            UEdGraphPin* PH_FormatProgramPin = PrintHelperNode->FindPinChecked(TEXT("FormatProgram"));
+            PH_FormatProgramPin->DefaultValue = FormatProgram;
 
             UEdGraphPin* PH_ExecIn = PrintHelperNode->GetExecPin();
             UEdGraphPin* PH_ThenOut = PrintHelperNode->GetThenPin();
@@ -1078,6 +959,8 @@ void UALS_Node::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* So
         };
 
 
+    const bool bStrippedInCook = IsStrippedInCook();
+
     // Process each Exec Input Pin.
     for (int32 i = 0; i < ExecInPins.Num(); i++)
     {
@@ -1089,27 +972,51 @@ void UALS_Node::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* So
             continue;
         }
 
-        // If node is inactive or if its a shipping build, spawn an empty helper to keep the execution intact
-        if (!bToggleNode)
+        // Inactive nodes and nodes stripped by the cook severity leave nothing behind, the exec wires are joined straight through
+        if (!bToggleNode || bStrippedInCook)
         {
-            UK2Node_CallFunction* EmptyNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-            EmptyNode->FunctionReference.SetExternalMember(FName("PrintHelperEmpty"), UALS_FunctionLibrary::StaticClass());
-            EmptyNode->AllocateDefaultPins();
+            TArray<UEdGraphPin*> SourcePins = ThisExecIn->LinkedTo;
+            UEdGraphPin* TargetPin = ThisThenOut->LinkedTo.Num() > 0 ? ThisThenOut->LinkedTo[0] : nullptr;
 
-            UEdGraphPin* EmptyExecIn = EmptyNode->GetExecPin();
-            UEdGraphPin* EmptyThenOut = EmptyNode->GetThenPin();
+            ThisExecIn->BreakAllPinLinks();
+            ThisThenOut->BreakAllPinLinks();
 
-            CompilerContext.MovePinLinksToIntermediate(*ThisExecIn, *EmptyExecIn);
-            CompilerContext.MovePinLinksToIntermediate(*ThisThenOut, *EmptyThenOut);
+            if (TargetPin)
+            {
+                for (UEdGraphPin* SourcePin : SourcePins)
+                {
+                    SourcePin->MakeLinkTo(TargetPin);
+                }
+            }
             continue;
         }
-        else
+
+        SpawnHelperNode(i, ThisExecIn, ThisThenOut);
+    }
+
+    BreakAllNodeLinks();
+}
+
+bool UALS_Node::IsStrippedInCook() const
+{
+    ELogSeverity NodeSeverity = LogSeverity;
+
+    if (UEdGraphPin* SeverityPin = FindPinById(LogSeverityPinId))
+    {
+        // A connected severity is only known at runtime
+        if (SeverityPin->HasAnyConnections())
+        {
+            return false;
+        }
+
+        const int64 PinValue = StaticEnum<ELogSeverity>()->GetValueByNameString(GetSavedDefaultValue(SeverityPin));
+        if (PinValue != INDEX_NONE)
         {
-            SpawnHelperNode(i, ThisExecIn, ThisThenOut);
+            NodeSeverity = static_cast<ELogSeverity>(PinValue);
         }
     }
 
-    BreakAllNodeLinks();
+    return UALS_Settings::IsSeverityStrippedInCook(NodeSeverity);
 }
 
 UEdGraphPin* UALS_Node::GetCorrespondingThenPin(UEdGraphPin* ExecInputPin) const
@@ -8,6 +8,7 @@
 #include "Widgets/Layout/SScrollBox.h"
 #include "EditorUndoClient.h"
 #include "Modules/ModuleManager.h"
+#include "Engine/StreamableManager.h"
 
 class FToolBarBuilder;
 class FMenuBuilder;
@@ -26,6 +27,16 @@ struct FLogSeverityRowData
     TSharedPtr<ELogSeverity> InitiallySelected;
 };
 
+// What the ALS window needs to know about one Blueprint, read from the asset registry tags or from the loaded Blueprint
+struct FALSBlueprintSummary
+{
+    int32 NodeCount = 0;
+    int32 EnabledCount = 0;
+    TArray<EPrintMode> PrintModes;
+    TArray<ELogSeverity> LogSeverities;
+    TArray<EPrintPreset> Presets;
+};
+
 class ALS_EDITOR_API FALSEditorModule : public IModuleInterface, public FEditorUndoClient
 {
 protected:
@@ -36,7 +47,7 @@ private:
     //ALS Nodes Window Functions
     void ShowBlueprintWindowForALS();
     TSharedRef<SWidget> CreateALSRow(const FAssetData& Blueprint, TArray<FAssetData>& RelevantBlueprints);
-    void GetBlueprintsWithALSNodes(TArray<FAssetData>& OutBlueprints) const;
+    void GetBlueprintsWithALSNodes(TArray<FAssetData>& OutBlueprints);
     EPrintMode GetBlueprintALSOutputMode(const FAssetData& BlueprintAsset) const;
     ELogSeverity GetBlueprintALSLogSeverity(const FAssetData& BlueprintAsset) const;
     ECheckBoxState GetBlueprintALSCheckedState(const FAssetData& BlueprintAsset) const;
@@ -45,6 +56,16 @@ private:
 
     void RefreshALSContainer();
 
+    // Loads and resaves the Blueprints saved before the ALS tags existed, so every later listing reads their tags
+    void TagUntaggedBlueprints();
+    TSharedRef<SWidget> CreateUntaggedNotice();
+
+    static void BuildALSSummary(const UBlueprint* Blueprint, FALSBlueprintSummary& OutSummary);
+
+    // False for a Blueprint that is neither loaded nor tagged, it is not loaded to be scanned
+    static bool GetALSSummary(const FAssetData& BlueprintAsset, FALSBlueprintSummary& OutSummary);
+    static void AddALSRegistryTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags);
+
 private:
     //Unreal's PrintString Nodes Window Functions
     void ShowBlueprintWindowForUPS();
@@ -57,6 +78,12 @@ private:
 
     void RefreshUPSContainer();
 
+private:
+    // Bulk edits for every listed Blueprint. Assets are streamed in first and all edited Blueprints are compiled in one batch
+    void RunBulkEdit(const TArray<FAssetData>& BlueprintAssets, const FText& TaskTitle, TFunction<void(const FAssetData&)> EditAsset);
+    TSharedRef<SWidget> CreateALSBulkBar();
+    TSharedRef<SWidget> CreateUPSBulkBar();
+
 private:
 
     void ShowAllALSLogs();
@@ -68,6 +95,7 @@ private:
 
 private:
     TSharedPtr<class FUICommandList> CommandsList;
+    FDelegateHandle RegistryTagsHandle;
 
     // Safe Changes Cache
     TMap<FAssetData, ECheckBoxState> PendingCheckedStateALS;
@@ -83,6 +111,16 @@ private:
     TSharedPtr<SScrollBox> ALSScrollContainer = nullptr;
     TSharedPtr<SScrollBox> UPSScrollContainer = nullptr;
 
+    TArray<FAssetData> ListedALSBlueprints;
+    TArray<FAssetData> ListedUPSBlueprints;
+
+    // Read once per listing, the row getters are polled by Slate every frame
+    TMap<FAssetData, FALSBlueprintSummary> ListedALSSummaries;
+    TArray<FAssetData> UntaggedALSBlueprints;
+
+    FStreamableManager BulkStreamableManager;
+    bool bBulkEditInProgress = false;
+
     TArray<TSharedPtr<FPrintModeRowData>> PrintModeRowCache;
     TArray<TSharedPtr<FLogSeverityRowData>> LogSeverityRowCache;
 
@@ -132,6 +132,7 @@ public:
     int32 GetExecPinCount() const;
 
     bool IsWildcardPin(const UEdGraphPin* Pin) const;
+    bool IsStrippedInCook() const;
     bool IsNonContextBP() const;
 
 private: